@@ -0,0 +1,172 @@
+/**
+ *
+ * @file    audio_backend.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Interface des moteurs de rendu audio de minGL
+ *
+ **/
+
+#ifndef AUDIO_BACKEND_H
+#define AUDIO_BACKEND_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace nsAudio
+{
+
+/**
+ * @brief SoundHandle_t : Identifiant d'un buffer chargé, indice dans la table des buffers
+ */
+typedef size_t SoundHandle_t;
+
+/**
+ * @brief KInvalidSoundHandle : Identifiant ne désignant aucun buffer
+ */
+const SoundHandle_t KInvalidSoundHandle = static_cast<SoundHandle_t>(-1);
+
+/**
+ * @class IDecodedSound
+ * @brief Son lu depuis un fichier, prêt a être confié au backend qui l'a produit
+ *
+ * Le contenu dépend du backend : un buffer décodé, un flux ouvert, ...
+ */
+class IDecodedSound
+{
+public:
+    /**
+     * @brief Destructeur virtuel pour la classe IDecodedSound
+     * @fn virtual ~IDecodedSound() = default;
+     */
+    virtual ~IDecodedSound() = default;
+}; // class IDecodedSound
+
+/**
+ * @brief DecodedSoundPtr_t : Définition de type représentant un son décodé, nul si le fichier n'a pas pu être lu
+ */
+typedef std::unique_ptr<IDecodedSound> DecodedSoundPtr_t;
+
+/**
+ * @class IAudioBackend
+ * @brief Interface de ce qui produit réellement le son pour AudioEngine
+ *
+ * AudioEngine garde la table des noms, le choix des voix et les compteurs,
+ * le backend ne fait que charger les buffers et jouer ce qu'on lui demande sur la voix indiquée.
+ *
+ * La lecture des fichiers est séparée de leur mise en place : decodeSound() et openStream() peuvent être appelées
+ * depuis un autre thread que celui du jeu, en même temps que les autres fonctions, et ne doivent donc pas modifier le backend.
+ * Toutes les autres fonctions sont appelées depuis le thread du jeu.
+ */
+class IAudioBackend
+{
+public:
+    /**
+     * @brief Destructeur virtuel pour la classe IAudioBackend
+     * @fn virtual ~IAudioBackend() = default;
+     */
+    virtual ~IAudioBackend() = default;
+
+    /**
+     * @brief Alloue les voix du pool
+     * @param[in] voiceCount : Nombre de voix
+     * @fn virtual void setVoiceCount(const size_t& voiceCount) = 0;
+     */
+    virtual void setVoiceCount(const size_t& voiceCount) = 0;
+
+    /**
+     * @brief Décode entièrement un fichier audio, pour en faire un buffer
+     * @param[in] fileName : Nom du fichier
+     * @return Le son décodé, nul si le fichier n'a pas pu être lu
+     * @fn virtual DecodedSoundPtr_t decodeSound(const std::string& fileName) const = 0;
+     *
+     * Peut être appelée depuis n'importe quel thread.
+     */
+    virtual DecodedSoundPtr_t decodeSound(const std::string& fileName) const = 0;
+
+    /**
+     * @brief Ouvre un fichier audio pour le jouer en flux, comme musique ou avec playStream()
+     * @param[in] fileName : Nom du fichier
+     * @return Le flux ouvert, nul si le fichier n'a pas pu être lu
+     * @fn virtual DecodedSoundPtr_t openStream(const std::string& fileName) const = 0;
+     *
+     * Peut être appelée depuis n'importe quel thread.
+     */
+    virtual DecodedSoundPtr_t openStream(const std::string& fileName) const = 0;
+
+    /**
+     * @brief Range un son décodé dans un buffer
+     * @param[in] handle : Identifiant attribué au buffer par AudioEngine
+     * @param[in] sound : Son renvoyé par decodeSound(), non nul
+     * @fn virtual void setBuffer(const SoundHandle_t& handle, DecodedSoundPtr_t sound) = 0;
+     */
+    virtual void setBuffer(const SoundHandle_t& handle, DecodedSoundPtr_t sound) = 0;
+
+    /**
+     * @brief Libère un buffer, en arrêtant d'abord les voix qui le jouent
+     * @param[in] handle : Identifiant du buffer
+     * @fn virtual void releaseBuffer(const SoundHandle_t& handle) = 0;
+     */
+    virtual void releaseBuffer(const SoundHandle_t& handle) = 0;
+
+    /**
+     * @brief Joue un buffer depuis le début sur une voix, en interrompant ce qu'elle jouait
+     * @param[in] voice : Indice de la voix
+     * @param[in] handle : Identifiant du buffer
+     * @fn virtual void playVoice(const size_t& voice, const SoundHandle_t& handle) = 0;
+     */
+    virtual void playVoice(const size_t& voice, const SoundHandle_t& handle) = 0;
+
+    /**
+     * @brief Arrête une voix
+     * @param[in] voice : Indice de la voix
+     * @fn virtual void stopVoice(const size_t& voice) = 0;
+     */
+    virtual void stopVoice(const size_t& voice) = 0;
+
+    /**
+     * @brief Indique si une voix est en cours de lecture
+     * @param[in] voice : Indice de la voix
+     * @fn virtual bool isVoicePlaying(const size_t& voice) const = 0;
+     */
+    virtual bool isVoicePlaying(const size_t& voice) const = 0;
+
+    /**
+     * @brief Remplace la musique
+     * @param[in] music : Flux renvoyé par openStream(), non nul
+     * @param[in] loop : Indique si la musique est lue en boucle
+     * @fn virtual void setMusic(DecodedSoundPtr_t music, bool loop) = 0;
+     */
+    virtual void setMusic(DecodedSoundPtr_t music, bool loop) = 0;
+
+    /**
+     * @brief Règle l'état de lecture de la musique
+     * @param[in] playing : Nouvel état de lecture
+     * @fn virtual void setMusicPlaying(bool playing) = 0;
+     */
+    virtual void setMusicPlaying(bool playing) = 0;
+
+    /**
+     * @brief Récupère l'état de lecture de la musique
+     * @fn virtual bool isMusicPlaying() const = 0;
+     */
+    virtual bool isMusicPlaying() const = 0;
+
+    /**
+     * @brief Relance la musique depuis le début
+     * @fn virtual void restartMusic() = 0;
+     */
+    virtual void restartMusic() = 0;
+
+    /**
+     * @brief Joue un flux une fois, hors du pool de voix
+     * @param[in] stream : Flux renvoyé par openStream(), non nul
+     * @fn virtual void playStream(DecodedSoundPtr_t stream) = 0;
+     */
+    virtual void playStream(DecodedSoundPtr_t stream) = 0;
+}; // class IAudioBackend
+
+} // namespace nsAudio
+
+#endif // AUDIO_BACKEND_H
@@ -3,7 +3,7 @@
  * @file    audioengine.h
  * @author  Clément Mathieu--Drif
  * @date    Septembre 2020
- * @version 1.0
+ * @version 1.1
  * @brief   Gestionnaire audio de minGL
  *
  **/
@@ -11,9 +11,16 @@
 #ifndef AUDIOENGINE_H
 #define AUDIOENGINE_H
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
-#include <list>
-#include <SFML/Audio.hpp> // based on SFML
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "audio_backend.h"
 
 /**
  * @namespace nsAudio
@@ -21,6 +28,39 @@
  */
 namespace nsAudio
 {
+/**
+ * @brief VoiceHandle_t : Identifiant d'un son joué par une voix du pool
+ *
+ * Les bits de poids faible donnent l'indice de la voix, les autres le numéro de lecture :
+ * un identifiant devient invalide dès que sa voix est réutilisée.
+ */
+typedef unsigned long long VoiceHandle_t;
+
+/**
+ * @brief KInvalidVoiceHandle : Identifiant ne désignant aucun son (son abandonné faute de voix)
+ */
+const VoiceHandle_t KInvalidVoiceHandle = static_cast<VoiceHandle_t>(-1);
+
+/**
+ * @brief KMaxVoices : Nombre maximal de voix d'un pool
+ */
+const size_t KMaxVoices = 256;
+
+/**
+ * @brief KDefaultVoiceCount : Nombre de voix par défaut
+ */
+const size_t KDefaultVoiceCount = 16;
+
+/**
+ * @brief État de chargement d'un buffer
+ */
+enum SoundState {
+    SOUND_UNLOADED, /**< Identifiant inconnu ou buffer retiré */
+    SOUND_LOADING,  /**< En cours de décodage sur le thread de chargement */
+    SOUND_READY,    /**< Prêt a être joué */
+    SOUND_FAILED,   /**< Le fichier n'a pas pu être décodé */
+};
+
 /**
  * @class AudioEngine
  * @brief Une classe de gestion des effets audio et de la musique
@@ -29,6 +69,41 @@ class AudioEngine
 {
 
 public:
+    /**
+     * @brief Constructeur pour la classe AudioEngine
+     * @param[in] voiceCount : Nombre de voix du pool, c'est a dire de sons pouvant être joués en même temps depuis des buffers
+     * @fn AudioEngine(const size_t& voiceCount = KDefaultVoiceCount);
+     *
+     * Toutes les voix sont allouées ici : jouer un son depuis un buffer n'alloue plus rien.
+     * Le son est joué par SFML, ou n'est pas joué du tout si minGL est compilé avec MINGL_NO_SFML.
+     */
+    explicit AudioEngine(const size_t& voiceCount = KDefaultVoiceCount);
+
+    /**
+     * @brief Constructeur pour la classe AudioEngine, avec un backend choisi
+     * @param[in] backend : Backend produisant le son (NullBackend, OfflineMixer, ...)
+     * @param[in] voiceCount : Nombre de voix du pool
+     * @fn AudioEngine(std::unique_ptr<IAudioBackend> backend, const size_t& voiceCount = KDefaultVoiceCount);
+     */
+    explicit AudioEngine(std::unique_ptr<IAudioBackend> backend, const size_t& voiceCount = KDefaultVoiceCount);
+
+    /**
+     * @brief Destructeur pour la classe AudioEngine
+     * @fn ~AudioEngine();
+     *
+     * Attend la fin du décodage en cours sur le thread de chargement, et abandonne les autres.
+     */
+    ~AudioEngine();
+
+    AudioEngine(const AudioEngine&) = delete;
+    AudioEngine& operator=(const AudioEngine&) = delete;
+
+    /**
+     * @brief Récupère le backend produisant le son
+     * @fn IAudioBackend& getBackend();
+     */
+    IAudioBackend& getBackend();
+
     /**
      * @brief Définit le fichier audio de la musique
      * @param[in] fileName : nom du fichier
@@ -58,12 +133,100 @@ public:
 
     /**
      * @brief Charge un fichier audio dans un buffer
-     * @fn void loadSound(const std::string & fileName);
+     * @param[in] fileName : nom du fichier
+     * @return L'identifiant du buffer, a conserver pour jouer le son sans recherche par nom
+     * @fn SoundHandle_t loadSound(const std::string & fileName);
+     *
+     * Si le fichier est déjà chargé, l'identifiant existant est renvoyé, même si son chargement asynchrone n'est pas terminé.
+     */
+    SoundHandle_t loadSound(const std::string& fileName);
+
+    /**
+     * @brief Demande le chargement d'un fichier audio dans un buffer, sur le thread de chargement
+     * @param[in] fileName : nom du fichier
+     * @return L'identifiant du buffer, utilisable tout de suite
+     * @fn SoundHandle_t loadSoundAsync(const std::string& fileName);
+     *
+     * Le fichier est lu et décodé en arrière-plan, puis le buffer est mis en place lors d'un appel a update().
+     * D'ici la, playSound() ignore cet identifiant. Si le fichier est déjà connu, l'identifiant existant est renvoyé.
+     */
+    SoundHandle_t loadSoundAsync(const std::string& fileName);
+
+    /**
+     * @brief Récupère l'état de chargement d'un buffer
+     * @param[in] handle : identifiant du buffer
+     * @fn SoundState getSoundState(const SoundHandle_t& handle) const;
+     */
+    SoundState getSoundState(const SoundHandle_t& handle) const;
+
+    /**
+     * @brief Indique si un buffer est prêt a être joué
+     * @param[in] handle : identifiant du buffer
+     * @fn bool isSoundReady(const SoundHandle_t& handle) const;
+     */
+    bool isSoundReady(const SoundHandle_t& handle) const;
+
+    /**
+     * @brief Demande le changement de musique, le fichier étant ouvert sur le thread de chargement
+     * @param[in] fileName : nom du fichier
+     * @param[in] loop : indique si la musique est lue en boucle ou non (oui par défaut)
+     * @param[in] playWhenReady : indique si la musique est lancée dès qu'elle est prête (oui par défaut)
+     * @fn void setMusicAsync(const std::string& fileName, bool loop = true, bool playWhenReady = true);
+     *
+     * La musique actuelle continue jusqu'a l'appel a update() qui met la nouvelle en place.
+     * Seule la dernière demande compte : une musique demandée entre temps est abandonnée.
+     */
+    void setMusicAsync(const std::string& fileName, bool loop = true, bool playWhenReady = true);
+
+    /**
+     * @brief Indique si une musique demandée par setMusicAsync() n'est pas encore en place
+     * @fn bool isMusicLoading() const;
+     */
+    bool isMusicLoading() const;
+
+    /**
+     * @brief Joue un son depuis un fichier, ouvert sur le thread de chargement
+     * @param[in] fileName : nom du fichier
+     * @fn void playSoundFromFileAsync(const std::string& fileName);
+     *
+     * Le son démarre lors de l'appel a update() qui suit la fin de son ouverture.
+     */
+    void playSoundFromFileAsync(const std::string& fileName);
+
+    /**
+     * @brief Met en place les fichiers chargés par le thread de chargement
+     * @fn void update();
+     *
+     * A appeler une fois par image depuis la boucle du jeu. Ne fait que des échanges de pointeurs : n'attend jamais de lecture disque.
+     */
+    void update();
+
+    /**
+     * @brief Récupère le nombre de fichiers que le thread de chargement n'a pas pu lire
+     * @fn unsigned long long getLoadErrorCount() const;
      */
-    void loadSound(const std::string& fileName);
+    unsigned long long getLoadErrorCount() const;
 
     /**
-     * @brief Retire un buffer de la liste
+     * @brief Retrouve l'identifiant d'un buffer a partir du nom de son fichier
+     * @param[in] fileName : nom du fichier
+     * @return L'identifiant du buffer, ou KInvalidSoundHandle s'il n'est pas chargé
+     * @fn SoundHandle_t findSound(const std::string& fileName) const;
+     */
+    SoundHandle_t findSound(const std::string& fileName) const;
+
+    /**
+     * @brief Retire un buffer de la table
+     * @param[in] handle : identifiant du buffer
+     * @fn void removeBuffer(const SoundHandle_t& handle);
+     *
+     * L'identifiant n'est pas réattribué, il devient simplement invalide.
+     */
+    void removeBuffer(const SoundHandle_t& handle);
+
+    /**
+     * @brief Retire un buffer de la table
+     * @param[in] fileName : nom du fichier
      * @fn void removeBuffer(const std::string & fileName);
      */
     void removeBuffer(const std::string & fileName);
@@ -80,10 +243,73 @@ public:
      */
     void startMusicFromBeginning();
 
+    /**
+     * @brief Joue un son depuis un buffer
+     * @param[in] handle : identifiant du buffer, renvoyé par loadSound()
+     * @param[in] priority : priorité du son (0 par défaut), utilisée quand toutes les voix sont occupées
+     * @return L'identifiant du son joué, ou KInvalidVoiceHandle s'il a été abandonné
+     * @fn VoiceHandle_t playSound(const SoundHandle_t& handle, int priority = 0);
+     *
+     * Le buffer est retrouvé par simple indexation, sans comparaison de chaînes.
+     * Si le buffer est encore en cours de chargement, rien n'est joué et KInvalidVoiceHandle est renvoyé.
+     * Le son est joué par une voix libre du pool. Si aucune ne l'est, la voix de plus faible priorité,
+     * et la plus ancienne a priorité égale, est volée si sa priorité ne dépasse pas celle du nouveau son.
+     * Sinon le nouveau son est abandonné.
+     */
+    VoiceHandle_t playSound(const SoundHandle_t& handle, int priority = 0);
+
+    /**
+     * @brief Indique si un son est toujours en cours de lecture
+     * @param[in] voice : identifiant renvoyé par playSound()
+     * @fn bool isVoicePlaying(const VoiceHandle_t& voice) const;
+     *
+     * Renvoie faux si le son est terminé, a été arrêté ou si sa voix a été réutilisée.
+     */
+    bool isVoicePlaying(const VoiceHandle_t& voice) const;
+
+    /**
+     * @brief Arrête un son, s'il est toujours joué
+     * @param[in] voice : identifiant renvoyé par playSound()
+     * @fn void stopVoice(const VoiceHandle_t& voice);
+     */
+    void stopVoice(const VoiceHandle_t& voice);
+
+    /**
+     * @brief Récupère le nombre de voix du pool
+     * @fn size_t getVoiceCount() const;
+     */
+    size_t getVoiceCount() const;
+
+    /**
+     * @brief Récupère le nombre de voix en cours de lecture
+     * @fn size_t getActiveVoiceCount() const;
+     */
+    size_t getActiveVoiceCount() const;
+
+    /**
+     * @brief Récupère le nombre de sons ayant interrompu un autre son pour prendre sa voix
+     * @fn unsigned long long getStealCount() const;
+     */
+    unsigned long long getStealCount() const;
+
+    /**
+     * @brief Récupère le nombre de sons abandonnés faute de voix
+     * @fn unsigned long long getDropCount() const;
+     */
+    unsigned long long getDropCount() const;
+
+    /**
+     * @brief Remet a zéro les compteurs de vols et d'abandons
+     * @fn void resetVoiceCounters();
+     */
+    void resetVoiceCounters();
+
     /**
      * @brief Joue un son depuis un buffer
      * @param[in] fileName : nom du fichier
      * @fn void playSoundFromBuffer(const std::string& fileName);
+     *
+     * Raccourci recherchant l'identifiant par nom a chaque appel : préférer playSound() pour les sons fréquents.
      */
     void playSoundFromBuffer(const std::string& fileName);
 
@@ -96,30 +322,190 @@ public:
 
 private:
     /**
-     * @brief m_buffers : Liste des buffers utilisés par les éléments de m_sounds
+     * @brief m_backend : Backend produisant le son
+     */
+    std::unique_ptr<IAudioBackend> m_backend;
+
+    /**
+     * @brief m_bufferStates : État de chargement du buffer de chaque identifiant
+     */
+    std::vector<SoundState> m_bufferStates;
+
+    /**
+     * @brief m_bufferHandles : Identifiant de chaque fichier chargé, consulté seulement par les fonctions prenant un nom
+     */
+    std::unordered_map<std::string, SoundHandle_t> m_bufferHandles;
+
+    /**
+     * @struct Voice
+     * @brief Une voix du pool, jouant au plus un son a la fois
+     */
+    struct Voice
+    {
+        /**
+         * @brief buffer : Buffer joué, KInvalidSoundHandle si aucun
+         */
+        SoundHandle_t buffer = KInvalidSoundHandle;
+
+        /**
+         * @brief priority : Priorité du son joué
+         */
+        int priority = 0;
+
+        /**
+         * @brief serial : Numéro de la lecture en cours, croissant : sert d'âge et invalide les anciens identifiants
+         */
+        unsigned long long serial = 0;
+    }; // struct Voice
+
+    /**
+     * @brief m_voices : Pool de voix jouant les sons depuis des buffers, alloué une fois pour toutes
+     */
+    std::vector<Voice> m_voices;
+
+    /**
+     * @brief m_nextSerial : Numéro de la prochaine lecture
+     */
+    unsigned long long m_nextSerial = 1;
+
+    /**
+     * @brief m_stealCount : Nombre de voix volées
+     */
+    unsigned long long m_stealCount = 0;
+
+    /**
+     * @brief m_dropCount : Nombre de sons abandonnés
+     */
+    unsigned long long m_dropCount = 0;
+
+    /**
+     * @brief Retrouve la voix jouant encore un son
+     * @param[in] voice : identifiant renvoyé par playSound()
+     * @return L'indice de la voix, ou m_voices.size() si l'identifiant est périmé
+     * @fn size_t findVoice(const VoiceHandle_t& voice) const;
+     */
+    size_t findVoice(const VoiceHandle_t& voice) const;
+
+    /**
+     * @struct LoadJob
+     * @brief Fichier a lire sur le thread de chargement
+     */
+    struct LoadJob
+    {
+        /**
+         * @brief Ce qu'il faut faire du fichier une fois lu
+         */
+        enum Kind {
+            LOAD_BUFFER, /**< Le décoder dans le buffer handle */
+            LOAD_MUSIC,  /**< L'ouvrir comme musique */
+            LOAD_STREAM, /**< L'ouvrir et le jouer une fois */
+        };
+
+        /**
+         * @brief kind : Ce qu'il faut faire du fichier
+         */
+        Kind kind;
+
+        /**
+         * @brief fileName : Nom du fichier
+         */
+        std::string fileName;
+
+        /**
+         * @brief handle : Buffer a remplir (LOAD_BUFFER)
+         */
+        SoundHandle_t handle = 0;
+
+        /**
+         * @brief request : Numéro de la demande de musique (LOAD_MUSIC)
+         */
+        unsigned long long request = 0;
+
+        /**
+         * @brief loop : Lecture en boucle de la musique (LOAD_MUSIC)
+         */
+        bool loop = false;
+
+        /**
+         * @brief play : Lancement de la musique dès sa mise en place (LOAD_MUSIC)
+         */
+        bool play = false;
+
+        /**
+         * @brief result : Son lu par le thread de chargement, nul en cas d'échec
+         */
+        DecodedSoundPtr_t result;
+    }; // struct LoadJob
+
+    /**
+     * @brief m_loader : Thread de chargement, démarré a la première demande asynchrone
+     */
+    std::thread m_loader;
+
+    /**
+     * @brief m_loaderMutex : Protège m_pendingJobs, m_finishedJobs et m_stopLoader
+     */
+    std::mutex m_loaderMutex;
+
+    /**
+     * @brief m_loaderCondition : Réveille le thread de chargement quand une demande arrive
+     */
+    std::condition_variable m_loaderCondition;
+
+    /**
+     * @brief m_pendingJobs : Fichiers en attente de lecture
+     */
+    std::deque<LoadJob> m_pendingJobs;
+
+    /**
+     * @brief m_finishedJobs : Fichiers lus, en attente de mise en place par update()
+     */
+    std::vector<LoadJob> m_finishedJobs;
+
+    /**
+     * @brief m_installedJobs : Fichiers en cours de mise en place, gardé pour ne pas réallouer a chaque update()
+     */
+    std::vector<LoadJob> m_installedJobs;
+
+    /**
+     * @brief m_stopLoader : Demande l'arrêt du thread de chargement
+     */
+    bool m_stopLoader = false;
+
+    /**
+     * @brief m_musicRequest : Numéro de la dernière demande de musique asynchrone, 0 si aucune n'est en cours
+     */
+    unsigned long long m_musicRequest = 0;
+
+    /**
+     * @brief m_nextMusicRequest : Numéro de la prochaine demande de musique asynchrone
      */
-    std::list<std::pair<std::string, sf::SoundBuffer>> m_buffers;
+    unsigned long long m_nextMusicRequest = 1;
 
     /**
-     * @brief m_sounds : Liste des effets audio en cours de lecture depuis des buffers
+     * @brief m_loadErrorCount : Nombre de fichiers que le thread de chargement n'a pas pu lire
      */
-    std::list<sf::Sound> m_sounds;
+    unsigned long long m_loadErrorCount = 0;
 
     /**
-     * @brief m_soundsFromFiles : Liste des effets audio en cours de lecture depuis des fichiers
+     * @brief Confie un fichier au thread de chargement, en le démarrant si besoin
+     * @param[in] job : Fichier a lire
+     * @fn void queueJob(LoadJob&& job);
      */
-    std::list<sf::Music> m_soundsFromFiles;
+    void queueJob(LoadJob&& job);
 
     /**
-     * @brief m_music : Musique principale
+     * @brief Boucle du thread de chargement
+     * @fn void loaderLoop();
      */
-    sf::Music m_music;
+    void loaderLoop();
 
     /**
-     * @brief Retire les sons terminés des listes m_sounds et m_soundsFromFiles
-     * @fn void removeOldSounds();
+     * @brief Libère un buffer dans le backend et oublie les voix qui le jouaient
+     * @param[in] handle : identifiant du buffer
+     * @fn void releaseBuffer(const SoundHandle_t& handle);
      */
-    void removeOldSounds();
+    void releaseBuffer(const SoundHandle_t& handle);
 
 }; // class AudioEngine
 
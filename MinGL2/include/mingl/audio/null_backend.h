@@ -0,0 +1,62 @@
+/**
+ *
+ * @file    null_backend.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Moteur de rendu audio muet
+ *
+ **/
+
+#ifndef NULL_BACKEND_H
+#define NULL_BACKEND_H
+
+#include "audio_backend.h"
+
+namespace nsAudio
+{
+
+/**
+ * @class NullBackend
+ * @brief Backend ne produisant aucun son, pour les exécutions sans carte son
+ *
+ * Aucun fichier n'est lu : tout chargement réussit et chaque son se termine aussitôt joué.
+ * Le nombre de lectures demandées reste consultable.
+ */
+class NullBackend : public IAudioBackend
+{
+public:
+    void setVoiceCount(const size_t& voiceCount) override;
+    DecodedSoundPtr_t decodeSound(const std::string& fileName) const override;
+    DecodedSoundPtr_t openStream(const std::string& fileName) const override;
+    void setBuffer(const SoundHandle_t& handle, DecodedSoundPtr_t sound) override;
+    void releaseBuffer(const SoundHandle_t& handle) override;
+    void playVoice(const size_t& voice, const SoundHandle_t& handle) override;
+    void stopVoice(const size_t& voice) override;
+    bool isVoicePlaying(const size_t& voice) const override;
+    void setMusic(DecodedSoundPtr_t music, bool loop) override;
+    void setMusicPlaying(bool playing) override;
+    bool isMusicPlaying() const override;
+    void restartMusic() override;
+    void playStream(DecodedSoundPtr_t stream) override;
+
+    /**
+     * @brief Récupère le nombre de sons joués sur les voix et depuis des fichiers
+     * @fn unsigned long long getPlayCount() const;
+     */
+    unsigned long long getPlayCount() const;
+
+private:
+    /**
+     * @brief m_playCount : Nombre de sons joués
+     */
+    unsigned long long m_playCount = 0;
+
+    /**
+     * @brief m_musicPlaying : État de lecture de la musique
+     */
+    bool m_musicPlaying = false;
+}; // class NullBackend
+
+} // namespace nsAudio
+
+#endif // NULL_BACKEND_H
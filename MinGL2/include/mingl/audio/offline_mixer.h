@@ -0,0 +1,221 @@
+/**
+ *
+ * @file    offline_mixer.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Moteur de rendu audio logiciel, sans carte son
+ *
+ **/
+
+#ifndef OFFLINE_MIXER_H
+#define OFFLINE_MIXER_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "audio_backend.h"
+
+namespace nsAudio
+{
+
+/**
+ * @class OfflineMixer
+ * @brief Backend mixant les sons dans un buffer PCM 16 bits en mémoire, a la demande
+ *
+ * Le temps n'avance que lors des appels a render() : une relecture sans carte son peut ainsi
+ * jouer des sons aussi vite qu'elle le souhaite, puis vérifier ou enregistrer le résultat.
+ * Seuls les fichiers .wav (PCM 8, 16, 24 bits ou flottant 32 bits) sont lus. Ils sont convertis
+ * une fois pour toutes au chargement vers la fréquence et le nombre de canaux du mixeur.
+ */
+class OfflineMixer : public IAudioBackend
+{
+public:
+    /**
+     * @brief Constructeur pour la classe OfflineMixer
+     * @param[in] sampleRate : Fréquence d'échantillonnage du rendu (44100 Hz par défaut)
+     * @param[in] channelCount : Nombre de canaux du rendu, 1 ou 2 (2 par défaut)
+     * @fn OfflineMixer(const unsigned& sampleRate = 44100, const unsigned& channelCount = 2);
+     */
+    OfflineMixer(const unsigned& sampleRate = 44100, const unsigned& channelCount = 2);
+
+    void setVoiceCount(const size_t& voiceCount) override;
+    DecodedSoundPtr_t decodeSound(const std::string& fileName) const override;
+    DecodedSoundPtr_t openStream(const std::string& fileName) const override;
+    void setBuffer(const SoundHandle_t& handle, DecodedSoundPtr_t sound) override;
+    void releaseBuffer(const SoundHandle_t& handle) override;
+    void playVoice(const size_t& voice, const SoundHandle_t& handle) override;
+    void stopVoice(const size_t& voice) override;
+    bool isVoicePlaying(const size_t& voice) const override;
+    void setMusic(DecodedSoundPtr_t music, bool loop) override;
+    void setMusicPlaying(bool playing) override;
+    bool isMusicPlaying() const override;
+    void restartMusic() override;
+    void playStream(DecodedSoundPtr_t stream) override;
+
+    /**
+     * @brief Mixe les sons en cours et ajoute le résultat a la suite des échantillons déjà rendus
+     * @param[in] frameCount : Nombre de trames a rendre (une trame = un échantillon par canal)
+     * @fn void render(const size_t& frameCount);
+     */
+    void render(const size_t& frameCount);
+
+    /**
+     * @brief Récupère les échantillons rendus, entrelacés par canal
+     * @fn const std::vector<int16_t>& getSamples() const;
+     */
+    const std::vector<int16_t>& getSamples() const;
+
+    /**
+     * @brief Oublie les échantillons rendus, sans toucher aux sons en cours
+     * @fn void clearSamples();
+     */
+    void clearSamples();
+
+    /**
+     * @brief Enregistre les échantillons rendus dans un fichier .wav
+     * @param[in] fileName : Nom du fichier
+     * @return Vrai si le fichier a pu être écrit
+     * @fn bool writeWav(const std::string& fileName) const;
+     */
+    bool writeWav(const std::string& fileName) const;
+
+    /**
+     * @brief Récupère la fréquence d'échantillonnage du rendu
+     * @fn unsigned getSampleRate() const;
+     */
+    unsigned getSampleRate() const;
+
+    /**
+     * @brief Récupère le nombre de canaux du rendu
+     * @fn unsigned getChannelCount() const;
+     */
+    unsigned getChannelCount() const;
+
+    /**
+     * @brief Récupère le nombre total de trames rendues depuis la dernière remise a zéro
+     * @fn unsigned long long getRenderedFrameCount() const;
+     */
+    unsigned long long getRenderedFrameCount() const;
+
+    /**
+     * @brief Récupère le temps total passé a mixer dans render() depuis la dernière remise a zéro
+     * @fn std::chrono::nanoseconds getMixingTime() const;
+     */
+    std::chrono::nanoseconds getMixingTime() const;
+
+    /**
+     * @brief Remet a zéro le nombre de trames rendues et le temps de mixage
+     * @fn void resetStats();
+     */
+    void resetStats();
+
+private:
+    /**
+     * @brief PcmData_t : Échantillons entrelacés, au format du mixeur, partagés entre un buffer et les voix qui le jouent
+     */
+    typedef std::shared_ptr<const std::vector<int16_t>> PcmData_t;
+
+    /**
+     * @struct Playback
+     * @brief Lecture en cours d'un son
+     */
+    struct Playback
+    {
+        /**
+         * @brief samples : Échantillons joués
+         */
+        PcmData_t samples;
+
+        /**
+         * @brief handle : Buffer joué, KInvalidSoundHandle pour la musique et les fichiers
+         */
+        SoundHandle_t handle = KInvalidSoundHandle;
+
+        /**
+         * @brief position : Position de lecture, en échantillons
+         */
+        size_t position = 0;
+
+        /**
+         * @brief loop : Indique si le son reprend au début une fois terminé
+         */
+        bool loop = false;
+
+        /**
+         * @brief playing : Indique si le son est en cours de lecture
+         */
+        bool playing = false;
+    }; // struct Playback
+
+    /**
+     * @brief Lit un fichier .wav et le convertit au format du mixeur
+     * @param[in] fileName : Nom du fichier
+     * @param[out] data : Échantillons convertis
+     * @return Vrai si le fichier a pu être lu
+     * @fn bool decodeWav(const std::string& fileName, PcmData_t& data) const;
+     */
+    bool decodeWav(const std::string& fileName, PcmData_t& data) const;
+
+    /**
+     * @brief Ajoute une lecture au mixage en cours, et l'avance d'autant
+     * @param[in, out] playback : Lecture a mixer
+     * @fn void mix(Playback& playback);
+     */
+    void mix(Playback& playback);
+
+    /**
+     * @brief m_sampleRate : Fréquence d'échantillonnage du rendu
+     */
+    unsigned m_sampleRate;
+
+    /**
+     * @brief m_channelCount : Nombre de canaux du rendu
+     */
+    unsigned m_channelCount;
+
+    /**
+     * @brief m_buffers : Table des buffers, indexée par identifiant (nul si libéré)
+     */
+    std::vector<PcmData_t> m_buffers;
+
+    /**
+     * @brief m_voices : Lecture en cours sur chaque voix
+     */
+    std::vector<Playback> m_voices;
+
+    /**
+     * @brief m_streams : Sons joués depuis des fichiers
+     */
+    std::vector<Playback> m_streams;
+
+    /**
+     * @brief m_music : Musique principale
+     */
+    Playback m_music;
+
+    /**
+     * @brief m_accumulator : Somme sur 32 bits des sons mixés pour le rendu en cours
+     */
+    std::vector<int32_t> m_accumulator;
+
+    /**
+     * @brief m_samples : Échantillons rendus
+     */
+    std::vector<int16_t> m_samples;
+
+    /**
+     * @brief m_renderedFrames : Nombre de trames rendues
+     */
+    unsigned long long m_renderedFrames = 0;
+
+    /**
+     * @brief m_mixingTime : Temps passé a mixer
+     */
+    std::chrono::nanoseconds m_mixingTime = std::chrono::nanoseconds::zero();
+}; // class OfflineMixer
+
+} // namespace nsAudio
+
+#endif // OFFLINE_MIXER_H
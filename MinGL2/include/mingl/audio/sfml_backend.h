@@ -0,0 +1,81 @@
+/**
+ *
+ * @file    sfml_backend.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Moteur de rendu audio basé sur SFML
+ *
+ **/
+
+#ifndef SFML_BACKEND_H
+#define SFML_BACKEND_H
+
+#include <list>
+#include <memory>
+#include <vector>
+#include <SFML/Audio.hpp> // based on SFML
+
+#include "audio_backend.h"
+
+namespace nsAudio
+{
+
+/**
+ * @class SfmlBackend
+ * @brief Backend jouant le son sur la carte son, au travers de SFML
+ */
+class SfmlBackend : public IAudioBackend
+{
+public:
+    void setVoiceCount(const size_t& voiceCount) override;
+    DecodedSoundPtr_t decodeSound(const std::string& fileName) const override;
+    DecodedSoundPtr_t openStream(const std::string& fileName) const override;
+    void setBuffer(const SoundHandle_t& handle, DecodedSoundPtr_t sound) override;
+    void releaseBuffer(const SoundHandle_t& handle) override;
+    void playVoice(const size_t& voice, const SoundHandle_t& handle) override;
+    void stopVoice(const size_t& voice) override;
+    bool isVoicePlaying(const size_t& voice) const override;
+    void setMusic(DecodedSoundPtr_t music, bool loop) override;
+    void setMusicPlaying(bool playing) override;
+    bool isMusicPlaying() const override;
+    void restartMusic() override;
+    void playStream(DecodedSoundPtr_t stream) override;
+
+private:
+    /**
+     * @brief m_buffers : Table des buffers décodés par decodeSound(), indexée par identifiant (nul si libéré)
+     *
+     * Les buffers sont alloués séparément : les voix gardent un pointeur vers eux, qui doit rester valide quand la table grandit.
+     */
+    std::vector<DecodedSoundPtr_t> m_buffers;
+
+    /**
+     * @brief m_voices : Sons SFML réutilisés d'une lecture a l'autre, un par voix
+     */
+    std::vector<sf::Sound> m_voices;
+
+    /**
+     * @brief m_voiceBuffers : Buffer rattaché a chaque voix, KInvalidSoundHandle si aucun
+     */
+    std::vector<SoundHandle_t> m_voiceBuffers;
+
+    /**
+     * @brief m_streams : Liste des effets audio en cours de lecture depuis des fichiers
+     */
+    std::list<DecodedSoundPtr_t> m_streams;
+
+    /**
+     * @brief m_music : Musique principale, nulle tant qu'aucune n'est définie
+     */
+    DecodedSoundPtr_t m_music;
+
+    /**
+     * @brief Retire les sons terminés de la liste m_streams
+     * @fn void removeOldStreams();
+     */
+    void removeOldStreams();
+}; // class SfmlBackend
+
+} // namespace nsAudio
+
+#endif // SFML_BACKEND_H
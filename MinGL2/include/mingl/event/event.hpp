@@ -24,6 +24,7 @@ enum EventType_t {
     MouseClick, /**< L'utilisateur a cliqué sur un des boutons de la souris */
     MouseMove /**< Le curseur s'est déplacé */,
     MouseDrag, /**< Le curseur s'est déplacé pendant qu'un des boutons de la souris était pressé */
+    WindowResize, /**< La fenêtre a été redimensionnée */
 };
 
 /**
@@ -46,6 +47,15 @@ struct MouseMoveData_t {
     int y; /**< Coordonnée Y du curseur, relative au coin supérieur-gauche de la fenêtre */
 };
 
+/**
+ * @struct WindowResizeData_t
+ * @brief Possède des données pour un événement WindowResize
+ */
+struct WindowResizeData_t {
+    int width; /**< Nouvelle largeur de la fenêtre */
+    int height; /**< Nouvelle hauteur de la fenêtre */
+};
+
 /**
  * @union EventData_t
  * @brief Union contenant les données d'un événement
@@ -53,6 +63,7 @@ struct MouseMoveData_t {
 union EventData_t {
     MouseClickData_t clickData; /**< Données pour un événement MouseClick */
     MouseMoveData_t moveData; /**< Données pour un événment MouseMove/MouseDrag */
+    WindowResizeData_t resizeData; /**< Données pour un événement WindowResize */
 };
 
 /**
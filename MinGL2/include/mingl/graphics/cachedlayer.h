@@ -0,0 +1,140 @@
+/**
+ *
+ * @file    cachedlayer.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Couche statique mise en cache dans une texture
+ *
+ **/
+
+#ifndef CACHEDLAYER_H
+#define CACHEDLAYER_H
+
+#include <vector>
+
+#include <GL/freeglut.h> // GLuint
+
+#include "idrawable.h"
+#include "rgbacolor.h"
+#include "vec2d.h"
+
+namespace nsGui {
+class Sprite;
+}
+
+namespace nsGraphics
+{
+
+/**
+ * @class CachedLayer
+ * @brief Compose des sprites statiques une seule fois, puis les affiche en une seule copie de texture
+ * @details Au premier affichage (ou après invalidate()), les pixels des sprites de la couche sont composés en mémoire
+ *          sur la couleur de fond de la fenêtre, puis envoyés dans une texture. Les affichages suivants ne dessinent plus
+ *          qu'un quadrilatère texturé. Rien n'est relu dans la fenêtre : le résultat ne dépend ni de ce qui la recouvre,
+ *          ni de sa taille. La texture a des côtés en puissances de deux, seules tolérées par OpenGL 1.x.
+ *          La couche est opaque : elle est pensée pour les fonds d'écran, a afficher en premier dans la frame.
+ */
+class CachedLayer : public IDrawable
+{
+
+public:
+    /**
+     * @brief Constructeur pour la classe CachedLayer
+     * @param[in] position : Position du coin haut-gauche de la zone mise en cache
+     * @param[in] size : Taille de la zone mise en cache
+     * @fn CachedLayer(const Vec2D& position, const Vec2D& size);
+     */
+    CachedLayer(const Vec2D& position, const Vec2D& size);
+
+    /**
+     * @brief Destructeur pour la classe CachedLayer, libère la texture
+     * @fn virtual ~CachedLayer() override;
+     */
+    virtual ~CachedLayer() override;
+
+    CachedLayer(const CachedLayer&) = delete;
+    CachedLayer& operator=(const CachedLayer&) = delete;
+
+    /**
+     * @brief Ajoute un sprite a la couche, et invalide le cache
+     * @details Le sprite n'est pas copié : il doit rester en vie tant qu'il fait partie de la couche.
+     *          Les sprites sont composés dans leur ordre d'ajout, chacun dans son mode de stockage.
+     * @param[in] sprite : Sprite a ajouter
+     * @fn void addSprite(const nsGui::Sprite& sprite);
+     */
+    void addSprite(const nsGui::Sprite& sprite);
+
+    /**
+     * @brief Retire tous les sprites de la couche, et invalide le cache
+     * @fn void clearSprites();
+     */
+    void clearSprites();
+
+    /**
+     * @brief Invalide le cache, a appeler quand les pixels ou la position d'un sprite de la couche ont changé
+     * @fn void invalidate();
+     */
+    void invalidate();
+
+    /**
+     * @brief Libère la texture, qui sera recréée au prochain affichage
+     * @details A appeler quand la couche ne sera plus affichée avant longtemps, par exemple après avoir retiré ses sprites.
+     * @fn void releaseTexture();
+     */
+    void releaseTexture();
+
+    /**
+     * @brief Indique si le cache est a jour
+     * @fn bool isValid() const;
+     */
+    bool isValid() const;
+
+    virtual void draw(MinGL& window) const override;
+
+private:
+    /**
+     * @brief Compose les sprites de la couche sur la couleur de fond, et envoie le résultat dans la texture
+     * @param[in] window : Fenêtre dont la couleur de fond est utilisée
+     * @fn void rebuild(MinGL& window) const;
+     */
+    void rebuild(MinGL& window) const;
+
+    /**
+     * @brief m_position : Position du coin haut-gauche de la zone mise en cache
+     */
+    Vec2D m_position;
+
+    /**
+     * @brief m_size : Taille de la zone mise en cache
+     */
+    Vec2D m_size;
+
+    /**
+     * @brief m_sprites : Sprites composant la couche, dans leur ordre d'affichage
+     */
+    std::vector<const nsGui::Sprite*> m_sprites;
+
+    /**
+     * @brief m_texture : Texture OpenGL contenant la couche (0 si pas encore créée)
+     */
+    mutable GLuint m_texture;
+
+    /**
+     * @brief m_textureSize : Taille de la texture, la puissance de deux supérieure ou égale a m_size sur chaque axe
+     */
+    mutable Vec2D m_textureSize;
+
+    /**
+     * @brief m_valid : Vrai si la texture est a jour
+     */
+    mutable bool m_valid;
+
+    /**
+     * @brief m_composedBackground : Couleur de fond de la fenêtre lors de la composition, pour invalider si elle change
+     */
+    mutable RGBAcolor m_composedBackground;
+}; // class CachedLayer
+
+} // namespace nsGraphics
+
+#endif // CACHEDLAYER_H
@@ -0,0 +1,99 @@
+/**
+ *
+ * @file    color_ops.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Traitements de couleur appliqués en bloc a des tableaux de pixels
+ *
+ **/
+
+#ifndef COLOR_OPS_H
+#define COLOR_OPS_H
+
+#include <cstddef>
+#include <vector>
+
+#include "rgbacolor.h"
+
+namespace nsGraphics
+{
+
+/**
+ * @brief Multiplie chaque composante des pixels par celle de la teinte (255 laissant la composante inchangée)
+ * @param[in, out] pixels : Premier pixel du tableau
+ * @param[in] count : Nombre de pixels
+ * @param[in] tint : Teinte a appliquer, transparence comprise
+ * @fn void tintPixels(RGBAcolor* pixels, const size_t& count, const RGBAcolor& tint);
+ *
+ * Toutes les fonctions de ce fichier travaillent en arithmétique entière arrondie au plus proche,
+ * sur des boucles que le compilateur peut vectoriser : elles sont faites pour les effets appliqués
+ * a tout un sprite (voir nsGui::Sprite::getPixelData()).
+ */
+void tintPixels(RGBAcolor* pixels, const size_t& count, const RGBAcolor& tint);
+
+/**
+ * @brief Multiplie la transparence des pixels par alpha / 255
+ * @param[in, out] pixels : Premier pixel du tableau
+ * @param[in] count : Nombre de pixels
+ * @param[in] alpha : Opacité a appliquer, de 0 (invisible) a 255 (inchangé)
+ * @fn void fadePixels(RGBAcolor* pixels, const size_t& count, const GLubyte& alpha);
+ */
+void fadePixels(RGBAcolor* pixels, const size_t& count, const GLubyte& alpha);
+
+/**
+ * @brief Rapproche la couleur des pixels d'une couleur donnée, sans toucher a leur transparence
+ * @param[in, out] pixels : Premier pixel du tableau
+ * @param[in] count : Nombre de pixels
+ * @param[in] color : Couleur visée, par exemple du blanc pour un flash
+ * @param[in] amount : Proportion de la couleur visée, de 0 (inchangé) a 255 (couleur visée)
+ * @fn void mixPixels(RGBAcolor* pixels, const size_t& count, const RGBAcolor& color, const GLubyte& amount);
+ */
+void mixPixels(RGBAcolor* pixels, const size_t& count, const RGBAcolor& color, const GLubyte& amount);
+
+/**
+ * @brief Multiplie le rouge, le vert et le bleu des pixels par leur transparence
+ * @param[in, out] pixels : Premier pixel du tableau
+ * @param[in] count : Nombre de pixels
+ * @fn void premultiplyPixels(RGBAcolor* pixels, const size_t& count);
+ */
+void premultiplyPixels(RGBAcolor* pixels, const size_t& count);
+
+/**
+ * @brief Compose des pixels prémultipliés par-dessus d'autres (opérateur "over")
+ * @param[in, out] destination : Premier pixel du fond, prémultiplié, qui reçoit le résultat
+ * @param[in] source : Premier pixel a poser dessus, prémultiplié
+ * @param[in] count : Nombre de pixels
+ * @fn void compositePremultipliedPixels(RGBAcolor* destination, const RGBAcolor* source, const size_t& count);
+ *
+ * Chaque composante vaut source + destination * (255 - transparence de la source) / 255 :
+ * une seule multiplication-addition, la source étant déjà multipliée par sa transparence.
+ */
+void compositePremultipliedPixels(RGBAcolor* destination, const RGBAcolor* source, const size_t& count);
+
+/**
+ * @brief Applique tintPixels() a tout un tableau
+ * @fn void tintPixels(std::vector<RGBAcolor>& pixels, const RGBAcolor& tint);
+ */
+void tintPixels(std::vector<RGBAcolor>& pixels, const RGBAcolor& tint);
+
+/**
+ * @brief Applique fadePixels() a tout un tableau
+ * @fn void fadePixels(std::vector<RGBAcolor>& pixels, const GLubyte& alpha);
+ */
+void fadePixels(std::vector<RGBAcolor>& pixels, const GLubyte& alpha);
+
+/**
+ * @brief Applique mixPixels() a tout un tableau
+ * @fn void mixPixels(std::vector<RGBAcolor>& pixels, const RGBAcolor& color, const GLubyte& amount);
+ */
+void mixPixels(std::vector<RGBAcolor>& pixels, const RGBAcolor& color, const GLubyte& amount);
+
+/**
+ * @brief Applique premultiplyPixels() a tout un tableau
+ * @fn void premultiplyPixels(std::vector<RGBAcolor>& pixels);
+ */
+void premultiplyPixels(std::vector<RGBAcolor>& pixels);
+
+} // namespace nsGraphics
+
+#endif // COLOR_OPS_H
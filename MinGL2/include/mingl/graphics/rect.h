@@ -0,0 +1,141 @@
+/**
+ *
+ * @file    rect.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Représente un rectangle aligné sur les axes
+ *
+ **/
+
+#ifndef RECT_H
+#define RECT_H
+
+#include <ostream>
+
+#include "vec2d.h"
+
+namespace nsGraphics
+{
+
+/**
+ * @class Rect
+ * @brief Rectangle aligné sur les axes, pour les tests de collision
+ *
+ * Le rectangle est semi-ouvert : il contient son coin minimal mais pas son coin maximal,
+ * comme une plage [début, fin[. Un sprite de taille (w, h) placé en (x, y) occupe donc exactement
+ * Rect::fromPositionSize((x, y), (w, h)), et deux sprites côte a côte ne se touchent pas.
+ * Tous les tests se font en comparaisons entières, sans racine carrée.
+ */
+class Rect
+{
+
+public:
+    /**
+     * @brief Constructeur pour la classe Rect
+     * @param[in] firstCorner : Premier coin
+     * @param[in] secondCorner : Coin opposé, exclu du rectangle
+     * @fn constexpr Rect(const Vec2D& firstCorner = Vec2D(), const Vec2D& secondCorner = Vec2D());
+     *
+     * Les coins peuvent être donnés dans n'importe quel ordre.
+     */
+    constexpr Rect(const Vec2D& firstCorner = Vec2D(), const Vec2D& secondCorner = Vec2D());
+
+    /**
+     * @brief Construit le rectangle d'une position et d'une taille
+     * @param[in] position : Coin haut-gauche
+     * @param[in] size : Largeur et hauteur
+     * @fn static constexpr Rect fromPositionSize(const Vec2D& position, const Vec2D& size);
+     */
+    static constexpr Rect fromPositionSize(const Vec2D& position, const Vec2D& size);
+
+    /**
+     * @brief Récupère le coin minimal (haut-gauche), inclus
+     * @fn constexpr Vec2D getMin() const;
+     */
+    constexpr Vec2D getMin() const;
+
+    /**
+     * @brief Récupère le coin maximal (bas-droit), exclu
+     * @fn constexpr Vec2D getMax() const;
+     */
+    constexpr Vec2D getMax() const;
+
+    /**
+     * @brief Calcule la taille du rectangle
+     * @fn constexpr Vec2D computeSize() const;
+     */
+    constexpr Vec2D computeSize() const;
+
+    /**
+     * @brief Retourne vrai si le rectangle ne contient aucun point
+     * @fn constexpr bool isEmpty() const;
+     */
+    constexpr bool isEmpty() const;
+
+    /**
+     * @brief Retourne vrai si le point est dans le rectangle
+     * @param[in] point : Point a tester
+     * @fn constexpr bool contains(const Vec2D& point) const;
+     */
+    constexpr bool contains(const Vec2D& point) const;
+
+    /**
+     * @brief Retourne vrai si les deux rectangles ont au moins un point en commun
+     * @param[in] other : Rectangle a tester
+     * @fn constexpr bool intersects(const Rect& other) const;
+     */
+    constexpr bool intersects(const Rect& other) const;
+
+    /**
+     * @brief Calcule l'intersection des deux rectangles
+     * @param[in] other : Autre rectangle
+     * @return L'intersection, vide si les rectangles ne se touchent pas
+     * @fn constexpr Rect computeIntersection(const Rect& other) const;
+     */
+    constexpr Rect computeIntersection(const Rect& other) const;
+
+    /**
+     * @brief Retourne ce rectangle déplacé
+     * @param[in] delta : Déplacement
+     * @fn constexpr Rect translated(const Vec2D& delta) const;
+     */
+    constexpr Rect translated(const Vec2D& delta) const;
+
+    /**
+     * @brief Opérateur d'égalité
+     * @param[in] other : Rectangle avec lequel vérifier l'égalité
+     * @fn constexpr bool operator==(const Rect& other) const;
+     */
+    constexpr bool operator==(const Rect& other) const;
+
+    /**
+     * @brief Opérateur d'inégalité
+     * @param[in] other : Rectangle avec lequel vérifier l'inégalité
+     * @fn constexpr bool operator!=(const Rect& other) const;
+     */
+    constexpr bool operator!=(const Rect& other) const;
+
+private:
+    /**
+     * @brief m_min : Coin minimal, inclus
+     */
+    Vec2D m_min;
+
+    /**
+     * @brief m_max : Coin maximal, exclu
+     */
+    Vec2D m_max;
+
+}; // class Rect
+
+/**
+ * @brief Écrit un rectangle dans un flux, sous la forme "[min ; max["
+ * @fn std::ostream& operator<<(std::ostream& os, const Rect& rect);
+ */
+std::ostream& operator<<(std::ostream& os, const Rect& rect);
+
+} // namespace nsGraphics
+
+#include "rect.hpp"
+
+#endif // RECT_H
@@ -0,0 +1,99 @@
+/**
+ *
+ * @file    rect.hpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Représente un rectangle aligné sur les axes
+ *
+ **/
+
+#ifndef RECT_HPP
+#define RECT_HPP
+
+#include <type_traits>
+
+#include "rect.h"
+
+constexpr nsGraphics::Rect::Rect(const Vec2D& firstCorner /* = Vec2D() */, const Vec2D& secondCorner /* = Vec2D() */)
+    : m_min(firstCorner.getX() < secondCorner.getX() ? firstCorner.getX() : secondCorner.getX(),
+            firstCorner.getY() < secondCorner.getY() ? firstCorner.getY() : secondCorner.getY())
+    , m_max(firstCorner.getX() < secondCorner.getX() ? secondCorner.getX() : firstCorner.getX(),
+            firstCorner.getY() < secondCorner.getY() ? secondCorner.getY() : firstCorner.getY())
+{} // Rect()
+
+constexpr nsGraphics::Rect nsGraphics::Rect::fromPositionSize(const Vec2D& position, const Vec2D& size)
+{
+    return Rect(position, position + size);
+} // fromPositionSize()
+
+constexpr nsGraphics::Vec2D nsGraphics::Rect::getMin() const
+{
+    return m_min;
+} // getMin()
+
+constexpr nsGraphics::Vec2D nsGraphics::Rect::getMax() const
+{
+    return m_max;
+} // getMax()
+
+constexpr nsGraphics::Vec2D nsGraphics::Rect::computeSize() const
+{
+    return m_max - m_min;
+} // computeSize()
+
+constexpr bool nsGraphics::Rect::isEmpty() const
+{
+    return m_min.getX() == m_max.getX() || m_min.getY() == m_max.getY();
+} // isEmpty()
+
+constexpr bool nsGraphics::Rect::contains(const Vec2D& point) const
+{
+    return m_min.getX() <= point.getX() && point.getX() < m_max.getX()
+        && m_min.getY() <= point.getY() && point.getY() < m_max.getY();
+} // contains()
+
+constexpr bool nsGraphics::Rect::intersects(const Rect& other) const
+{
+    // Sans le test de vide, un rectangle plat posé dans l'autre serait considéré en collision
+    return !isEmpty() && !other.isEmpty()
+        && m_min.getX() < other.m_max.getX() && other.m_min.getX() < m_max.getX()
+        && m_min.getY() < other.m_max.getY() && other.m_min.getY() < m_max.getY();
+} // intersects()
+
+constexpr nsGraphics::Rect nsGraphics::Rect::computeIntersection(const Rect& other) const
+{
+    return !intersects(other)
+        ? Rect()
+        : Rect(Vec2D(m_min.getX() < other.m_min.getX() ? other.m_min.getX() : m_min.getX(),
+                     m_min.getY() < other.m_min.getY() ? other.m_min.getY() : m_min.getY()),
+               Vec2D(m_max.getX() < other.m_max.getX() ? m_max.getX() : other.m_max.getX(),
+                     m_max.getY() < other.m_max.getY() ? m_max.getY() : other.m_max.getY()));
+} // computeIntersection()
+
+constexpr nsGraphics::Rect nsGraphics::Rect::translated(const Vec2D& delta) const
+{
+    return Rect(m_min + delta, m_max + delta);
+} // translated()
+
+constexpr bool nsGraphics::Rect::operator==(const Rect& other) const
+{
+    return m_min == other.m_min && m_max == other.m_max;
+} // operator==()
+
+constexpr bool nsGraphics::Rect::operator!=(const Rect& other) const
+{
+    return !operator==(other);
+} // operator!=()
+
+inline std::ostream& nsGraphics::operator<<(std::ostream& os, const Rect& rect)
+{
+    os << "[" << rect.getMin() << " ; " << rect.getMax() << "[";
+    return os;
+} // operator<<()
+
+static_assert(std::is_trivially_copyable<nsGraphics::Rect>::value, "Rect must stay trivially copyable");
+static_assert(nsGraphics::Rect(nsGraphics::Vec2D(0, 0), nsGraphics::Vec2D(10, 10)).contains(nsGraphics::Vec2D(0, 9))
+              && !nsGraphics::Rect(nsGraphics::Vec2D(0, 0), nsGraphics::Vec2D(10, 10)).contains(nsGraphics::Vec2D(10, 0)),
+              "Rect must be half-open");
+
+#endif // RECT_HPP
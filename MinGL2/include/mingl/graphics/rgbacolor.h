@@ -3,7 +3,7 @@
  * @file    rgbacolor.h
  * @author  Alexandre Sollier
  * @date    Janvier 2020
- * @version 1.1
+ * @version 1.2
  * @brief   Représente une couleur RGBA
  *
  **/
@@ -11,9 +11,10 @@
 #ifndef RGBACOLOR_H
 #define RGBACOLOR_H
 
-#include <GL/freeglut.h> // GLubyte
+#include <cstdint>
+#include <ostream>
 
-#include "../tools/ieditable.h"
+#include <GL/freeglut.h> // GLubyte
 
 namespace nsGraphics
 {
@@ -21,8 +22,13 @@ namespace nsGraphics
 /**
  * @class RGBAcolor
  * @brief Classe représentant un couleur RGBA8888
+ *
+ * Entièrement définie dans rgbacolor.hpp et trivialement copiable : ses quatre composantes sont rangées
+ * dans l'ordre R, G, B, A, ce qui permet de la passer telle quelle a glColor4ubv() et de traiter
+ * un tableau de pixels en bloc (voir color_ops.h).
+ * Les opérateurs + et * saturent a 0 et 255 au lieu de boucler modulo 256.
  */
-class RGBAcolor : public nsUtil::IEditable
+class RGBAcolor
 {
 
 public:
@@ -32,50 +38,70 @@ public:
      * @param[in] green : Taux de vert (0-255)
      * @param[in] blue : Taux de bleu (0-255)
      * @param[in] alpha : Taux de transparence (0-255)
-     * @fn RGBAcolor(const GLubyte& red = 0, const GLubyte& green = 0, const GLubyte& blue = 0, const GLubyte& alpha = 255);
+     * @fn constexpr RGBAcolor(const GLubyte& red = 0, const GLubyte& green = 0, const GLubyte& blue = 0, const GLubyte& alpha = 255);
      */
-    RGBAcolor(const GLubyte& red = 0, const GLubyte& green = 0, const GLubyte& blue = 0, const GLubyte& alpha = 255);
+    constexpr RGBAcolor(const GLubyte& red = 0, const GLubyte& green = 0, const GLubyte& blue = 0, const GLubyte& alpha = 255);
 
     /**
-     * @brief Destructeur virtuel pour la classe RGBAcolor
-     * @fn virtual ~RGBAcolor() override = default;
+     * @brief Construit une couleur depuis sa forme compacte
+     * @param[in] packed : Couleur compacte, voir toPacked()
+     * @fn static constexpr RGBAcolor fromPacked(const uint32_t& packed);
      */
-    virtual ~RGBAcolor() override = default;
+    static constexpr RGBAcolor fromPacked(const uint32_t& packed);
+
+    /**
+     * @brief Récupère la couleur sous forme compacte
+     * @return Rouge dans les bits 0-7, vert dans les bits 8-15, bleu dans les bits 16-23, transparence dans les bits 24-31
+     * @fn constexpr uint32_t toPacked() const;
+     */
+    constexpr uint32_t toPacked() const;
+
+    /**
+     * @brief Récupère les quatre composantes, dans l'ordre R, G, B, A
+     * @fn const GLubyte* data() const;
+     */
+    const GLubyte* data() const;
+
+    /**
+     * @brief Récupère les quatre composantes, dans l'ordre R, G, B, A
+     * @fn GLubyte* data();
+     */
+    GLubyte* data();
 
     /**
      * @brief Opérateur d'égalité
      * @param[in] col : Couleur a vérifier
-     * @fn bool operator==(const RGBAcolor& col) const;
+     * @fn constexpr bool operator==(const RGBAcolor& col) const;
      */
-    bool operator==(const RGBAcolor& col) const;
+    constexpr bool operator==(const RGBAcolor& col) const;
 
     /**
      * @brief Opérateur d'inégalité
      * @param[in] col : Couleur a vérifier
-     * @fn bool operator!=(const RGBAcolor& col) const;
+     * @fn constexpr bool operator!=(const RGBAcolor& col) const;
      */
-    bool operator!=(const RGBAcolor& col) const;
+    constexpr bool operator!=(const RGBAcolor& col) const;
 
     /**
-     * @brief Opérateur de décalage
+     * @brief Opérateur de décalage, saturé a 255 par composante
      * @param[in] rhs : Couleur a additionner
-     * @fn RGBAcolor operator+(const RGBAcolor& rhs) const;
+     * @fn constexpr RGBAcolor operator+(const RGBAcolor& rhs) const;
      */
-    RGBAcolor operator+(const RGBAcolor& rhs) const;
+    constexpr RGBAcolor operator+(const RGBAcolor& rhs) const;
 
     /**
-     * @brief Opérateur de réduction
+     * @brief Opérateur de réduction, borné entre 0 et 255 par composante
      * @param[in] rhs : Couleur avec laquelle multiplier la couleur actuelle
-     * @fn RGBAcolor operator*(const float& rhs) const;
+     * @fn constexpr RGBAcolor operator*(const float& rhs) const;
      */
-    RGBAcolor operator*(const float& rhs) const;
+    constexpr RGBAcolor operator*(const float& rhs) const;
 
     /**
      * @brief Récupère le taux de rouge
      * @return Une référence constante vers m_red
-     * @fn GLubyte getRed() const;
+     * @fn constexpr GLubyte getRed() const;
      */
-    GLubyte getRed() const;
+    constexpr GLubyte getRed() const;
 
     /**
      * @brief Définit le nouveau taux de rouge
@@ -87,9 +113,9 @@ public:
     /**
      * @brief Récupère le taux de vert
      * @return Une référence constante vers m_green
-     * @fn GLubyte getGreen() const;
+     * @fn constexpr GLubyte getGreen() const;
      */
-    GLubyte getGreen() const;
+    constexpr GLubyte getGreen() const;
 
     /**
      * @brief Définit le nouveau taux de vert
@@ -101,9 +127,9 @@ public:
     /**
      * @brief Récupère le taux de bleu
      * @return Une référence constante vers m_blue
-     * @fn GLubyte getBlue() const;
+     * @fn constexpr GLubyte getBlue() const;
      */
-    GLubyte getBlue() const;
+    constexpr GLubyte getBlue() const;
 
     /**
      * @brief Définit le nouveau taux de bleu
@@ -115,9 +141,9 @@ public:
     /**
      * @brief Récupère le taux de transparence
      * @return Une référence constante vers m_alpha
-     * @fn GLubyte getAlpha() const;
+     * @fn constexpr GLubyte getAlpha() const;
      */
-    GLubyte getAlpha() const;
+    constexpr GLubyte getAlpha() const;
 
     /**
      * @brief Définit le nouveau taux de transparence
@@ -126,51 +152,64 @@ public:
      */
     void setAlpha(const GLubyte& alpha);
 
-protected:
-    virtual std::ostream& _Edit(std::ostream& os = std::cout) const override;
-
 private:
     /**
-     * @brief m_red : Taux de rouge
+     * @brief Indices des composantes dans m_components
      */
-    GLubyte m_red;
+    enum : unsigned {
+        KIndexRed,
+        KIndexGreen,
+        KIndexBlue,
+        KIndexAlpha,
+    };
 
     /**
-     * @brief m_green : Taux de vert
+     * @brief Borne une valeur entre 0 et 255
+     * @fn static constexpr GLubyte saturate(const float& value);
      */
-    GLubyte m_green;
+    static constexpr GLubyte saturate(const float& value);
 
     /**
-     * @brief m_blue : Taux de bleu
+     * @brief m_components : Taux de rouge, de vert, de bleu et de transparence, dans cet ordre
      */
-    GLubyte m_blue;
-
-    /**
-     * @brief m_alpha : Taux de transparence
-     */
-    GLubyte m_alpha;
+    GLubyte m_components[4];
 
 }; // class RGBAcolor
 
+/**
+ * @brief Écrit une couleur dans un flux, sous la forme "R: r, G: g, B: b, A: a"
+ * @param[in, out] os : Flux de sortie
+ * @param[in] col : Couleur a écrire
+ * @fn std::ostream& operator<<(std::ostream& os, const RGBAcolor& col);
+ */
+std::ostream& operator<<(std::ostream& os, const RGBAcolor& col);
+
+} // namespace nsGraphics
+
+#include "rgbacolor.hpp"
+
+namespace nsGraphics
+{
+
 // Quelques couleurs trouvées sur:
 // https://www.rapidtables.com/web/color/RGB_Color.html
-const RGBAcolor KBlack       {  0,   0,   0};
-const RGBAcolor KWhite       {255, 255, 255};
-const RGBAcolor KRed         {255,   0,   0};
-const RGBAcolor KLime        {  0, 255,   0};
-const RGBAcolor KBlue        {  0,   0, 255};
-const RGBAcolor KYellow      {255, 255,   0};
-const RGBAcolor KCyan        {  0, 255, 255};
-const RGBAcolor KMagenta     {255,   0, 255};
-const RGBAcolor KSilver      {192, 192, 192};
-const RGBAcolor KGray        {128, 128, 128};
-const RGBAcolor KMaroon      {128,   0,   0};
-const RGBAcolor KOlive       {128, 128,   0};
-const RGBAcolor KGreen       {  0, 128,   0};
-const RGBAcolor KPurple      {128,   0, 128};
-const RGBAcolor KTeal        {  0, 128, 128};
-const RGBAcolor KNavy        {  0,   0, 128};
-const RGBAcolor KTransparent {  0,   0,   0,  0};
+constexpr RGBAcolor KBlack       {  0,   0,   0};
+constexpr RGBAcolor KWhite       {255, 255, 255};
+constexpr RGBAcolor KRed         {255,   0,   0};
+constexpr RGBAcolor KLime        {  0, 255,   0};
+constexpr RGBAcolor KBlue        {  0,   0, 255};
+constexpr RGBAcolor KYellow      {255, 255,   0};
+constexpr RGBAcolor KCyan        {  0, 255, 255};
+constexpr RGBAcolor KMagenta     {255,   0, 255};
+constexpr RGBAcolor KSilver      {192, 192, 192};
+constexpr RGBAcolor KGray        {128, 128, 128};
+constexpr RGBAcolor KMaroon      {128,   0,   0};
+constexpr RGBAcolor KOlive       {128, 128,   0};
+constexpr RGBAcolor KGreen       {  0, 128,   0};
+constexpr RGBAcolor KPurple      {128,   0, 128};
+constexpr RGBAcolor KTeal        {  0, 128, 128};
+constexpr RGBAcolor KNavy        {  0,   0, 128};
+constexpr RGBAcolor KTransparent {  0,   0,   0,  0};
 
 } // namespace nsGraphics
 
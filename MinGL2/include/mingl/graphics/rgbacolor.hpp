@@ -0,0 +1,130 @@
+/**
+ *
+ * @file    rgbacolor.hpp
+ * @author  Alexandre Sollier
+ * @date    Janvier 2020
+ * @version 1.2
+ * @brief   Représente une couleur RGBA
+ *
+ **/
+
+#ifndef RGBACOLOR_HPP
+#define RGBACOLOR_HPP
+
+#include <type_traits>
+
+#include "rgbacolor.h"
+
+constexpr nsGraphics::RGBAcolor::RGBAcolor(const GLubyte& red /* = 0 */, const GLubyte& green /* = 0 */,
+                                           const GLubyte& blue /* = 0 */, const GLubyte& alpha /* = 255 */)
+    : m_components{red, green, blue, alpha}
+{} // RGBAcolor()
+
+constexpr nsGraphics::RGBAcolor nsGraphics::RGBAcolor::fromPacked(const uint32_t& packed)
+{
+    return RGBAcolor(GLubyte(packed), GLubyte(packed >> 8), GLubyte(packed >> 16), GLubyte(packed >> 24));
+} // fromPacked()
+
+constexpr uint32_t nsGraphics::RGBAcolor::toPacked() const
+{
+    return uint32_t(m_components[KIndexRed])
+         | uint32_t(m_components[KIndexGreen]) << 8
+         | uint32_t(m_components[KIndexBlue]) << 16
+         | uint32_t(m_components[KIndexAlpha]) << 24;
+} // toPacked()
+
+inline const GLubyte* nsGraphics::RGBAcolor::data() const
+{
+    return m_components;
+} // data()
+
+inline GLubyte* nsGraphics::RGBAcolor::data()
+{
+    return m_components;
+} // data()
+
+constexpr bool nsGraphics::RGBAcolor::operator==(const RGBAcolor& col) const
+{
+    return toPacked() == col.toPacked();
+} // operator==()
+
+constexpr bool nsGraphics::RGBAcolor::operator!=(const RGBAcolor& col) const
+{
+    return toPacked() != col.toPacked();
+} // operator!=()
+
+constexpr GLubyte nsGraphics::RGBAcolor::saturate(const float& value)
+{
+    return value <= 0.f ? GLubyte(0) : (value >= 255.f ? GLubyte(255) : GLubyte(value));
+} // saturate()
+
+constexpr nsGraphics::RGBAcolor nsGraphics::RGBAcolor::operator+(const RGBAcolor& rhs) const
+{
+    return RGBAcolor(saturate(m_components[KIndexRed] + rhs.m_components[KIndexRed]),
+                     saturate(m_components[KIndexGreen] + rhs.m_components[KIndexGreen]),
+                     saturate(m_components[KIndexBlue] + rhs.m_components[KIndexBlue]),
+                     saturate(m_components[KIndexAlpha] + rhs.m_components[KIndexAlpha]));
+} // operator+()
+
+constexpr nsGraphics::RGBAcolor nsGraphics::RGBAcolor::operator*(const float& rhs) const
+{
+    return RGBAcolor(saturate(m_components[KIndexRed] * rhs),
+                     saturate(m_components[KIndexGreen] * rhs),
+                     saturate(m_components[KIndexBlue] * rhs),
+                     saturate(m_components[KIndexAlpha] * rhs));
+} // operator*()
+
+constexpr GLubyte nsGraphics::RGBAcolor::getAlpha() const
+{
+    return m_components[KIndexAlpha];
+} // getAlpha()
+
+inline void nsGraphics::RGBAcolor::setAlpha(const GLubyte& alpha)
+{
+    m_components[KIndexAlpha] = alpha;
+} // setAlpha()
+
+constexpr GLubyte nsGraphics::RGBAcolor::getBlue() const
+{
+    return m_components[KIndexBlue];
+} // getBlue()
+
+inline void nsGraphics::RGBAcolor::setBlue(const GLubyte& blue)
+{
+    m_components[KIndexBlue] = blue;
+} // setBlue()
+
+constexpr GLubyte nsGraphics::RGBAcolor::getGreen() const
+{
+    return m_components[KIndexGreen];
+} // getGreen()
+
+inline void nsGraphics::RGBAcolor::setGreen(const GLubyte& green)
+{
+    m_components[KIndexGreen] = green;
+} // setGreen()
+
+constexpr GLubyte nsGraphics::RGBAcolor::getRed() const
+{
+    return m_components[KIndexRed];
+} // getRed()
+
+inline void nsGraphics::RGBAcolor::setRed(const GLubyte& red)
+{
+    m_components[KIndexRed] = red;
+} // setRed()
+
+inline std::ostream& nsGraphics::operator<<(std::ostream& os, const RGBAcolor& col)
+{
+    os << "R: " << int(col.getRed()) << ", G: " << int(col.getGreen()) << ", B: " << int(col.getBlue())
+       << ", A: " << int(col.getAlpha());
+    return os;
+} // operator<<()
+
+static_assert(std::is_trivially_copyable<nsGraphics::RGBAcolor>::value, "RGBAcolor must stay trivially copyable");
+static_assert(std::is_standard_layout<nsGraphics::RGBAcolor>::value && sizeof(nsGraphics::RGBAcolor) == 4,
+              "RGBAcolor must stay laid out as four bytes, so that pixel arrays can be processed in bulk");
+static_assert(nsGraphics::RGBAcolor(200, 100, 0, 255) + nsGraphics::RGBAcolor(100, 100, 0, 0)
+              == nsGraphics::RGBAcolor(255, 200, 0, 255), "RGBAcolor addition must saturate");
+
+#endif // RGBACOLOR_HPP
@@ -3,7 +3,7 @@
  * @file    vec2d.h
  * @author  Alexandre Sollier
  * @date    Janvier 2020
- * @version 1.3
+ * @version 1.4
  * @brief   Représente un vecteur sur deux dimensions
  *
  **/
@@ -13,16 +13,18 @@
 
 #include <ostream>
 
-#include "../tools/ieditable.h"
-
 namespace nsGraphics
 {
 
 /**
  * @class Vec2D
  * @brief Classe représentant un vecteur deux-dimensionnel
+ *
+ * Entièrement définie dans vec2d.hpp et trivialement copiable : elle se manipule comme deux int,
+ * peut être rangée dans un std::array ou copiée en bloc, et ses opérations sont utilisables dans des expressions constantes.
+ * Les fonctions modifiant le vecteur ne sont pas constexpr, minGL étant compilée en C++11.
  */
-class Vec2D : public nsUtil::IEditable
+class Vec2D
 {
 
 public:
@@ -30,130 +32,133 @@ public:
      * @brief Constructeur pour la classe Vec2D
      * @param[in] x : Position X (abscisse) du vecteur
      * @param[in] y : Position Y (ordonnée) du vecteur
-     * @fn Vec2D(const int& x = 0, const int& y = 0);
+     * @fn constexpr Vec2D(const int& x = 0, const int& y = 0);
      */
-    Vec2D(const int& x = 0, const int& y = 0);
+    constexpr Vec2D(const int& x = 0, const int& y = 0);
 
     /**
      * @brief Constructeur de recopie pour la classe Vec2D
      * @param[in] pos : Vec2D a copier
-     * @fn Vec2D(const Vec2D& pos);
+     * @fn Vec2D(const Vec2D& pos) = default;
      */
-    Vec2D(const Vec2D& pos);
+    Vec2D(const Vec2D& pos) = default;
 
     /**
      * @brief Opérateur unaire plus
-     * @fn Vec2D operator+() const;
+     * @fn constexpr Vec2D operator+() const;
      */
-    Vec2D operator+() const;
+    constexpr Vec2D operator+() const;
 
     /**
      * @brief Opérateur unaire moins
-     * @fn Vec2D operator-() const;
+     * @fn constexpr Vec2D operator-() const;
      */
-    Vec2D operator-() const;
+    constexpr Vec2D operator-() const;
 
     /**
      * @brief Opérateur d'addition
      * @param[in] pos : Vecteur a additionner
-     * @fn Vec2D operator+(const Vec2D& pos) const;
+     * @fn constexpr Vec2D operator+(const Vec2D& pos) const;
      */
-    Vec2D operator+(const Vec2D& pos) const;
+    constexpr Vec2D operator+(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur de soustraction
      * @param[in] pos : Vecteur a soustraire
-     * @fn Vec2D operator-(const Vec2D& pos) const;
+     * @fn constexpr Vec2D operator-(const Vec2D& pos) const;
      */
-    Vec2D operator-(const Vec2D& pos) const;
+    constexpr Vec2D operator-(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur de multiplication
      * @param[in] pos : Vecteur a multiplier
-     * @fn Vec2D operator*(const Vec2D& pos) const;
+     * @fn constexpr Vec2D operator*(const Vec2D& pos) const;
      */
-    Vec2D operator*(const Vec2D& pos) const;
+    constexpr Vec2D operator*(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur de multiplication
      * @param[in] n : Nombre avec lequel multiplier le vecteur actuel
-     * @fn Vec2D operator*(const float& n) const;
+     * @fn constexpr Vec2D operator*(const float& n) const;
      */
-    Vec2D operator*(const float& n) const;
+    constexpr Vec2D operator*(const float& n) const;
 
     /**
      * @brief Opérateur de division
      * @param[in] pos : Vecteur a diviser
-     * @fn Vec2D operator/(const Vec2D& pos) const;
+     * @fn constexpr Vec2D operator/(const Vec2D& pos) const;
      */
-    Vec2D operator/(const Vec2D& pos) const;
+    constexpr Vec2D operator/(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur de division
      * @param[in] n : Nombre avec lequel diviser le vecteur actuel
-     * @fn Vec2D operator/(const float& n) const;
+     * @fn constexpr Vec2D operator/(const float& n) const;
      */
-    Vec2D operator/(const float& n) const;
+    constexpr Vec2D operator/(const float& n) const;
 
     /**
      * @brief Opérateur modulo
      * @param[in] pos : Vecteur avec lequel faire un modulo
-     * @fn Vec2D operator%(const Vec2D& pos) const;
+     * @fn constexpr Vec2D operator%(const Vec2D& pos) const;
      */
-    Vec2D operator%(const Vec2D& pos) const;
+    constexpr Vec2D operator%(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur d'égalité
      * @param[in] pos : Vecteur avec lequel vérifier l'égalité
-     * @fn bool operator==(const Vec2D& pos) const;
+     * @fn constexpr bool operator==(const Vec2D& pos) const;
      */
-    bool operator==(const Vec2D& pos) const;
+    constexpr bool operator==(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur d'inégalité
      * @param[in] pos : Vecteur avec lequel vérifier l'inégalité
-     * @fn bool operator!=(const Vec2D& pos) const;
+     * @fn constexpr bool operator!=(const Vec2D& pos) const;
      */
-    bool operator!=(const Vec2D& pos) const;
+    constexpr bool operator!=(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur de stricte infériorité
      * (Vérifie la stricte infériorité de la magnitude des deux vecteurs)
+     *
+     * Ces opérateurs de magnitude sont conservés pour le code existant ; ils comparent les magnitudes au carré, sans racine.
+     * Pour tester si un point est dans un rectangle, utiliser nsGraphics::Rect.
      * @param[in] pos : Vecteur avec lequel vérifier la stricte infériorité
-     * @fn bool operator<(const Vec2D& pos) const;
+     * @fn constexpr bool operator<(const Vec2D& pos) const;
      */
-    bool operator<(const Vec2D& pos) const;
+    constexpr bool operator<(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur de stricte supériorité
      * (Vérifie la stricte supériorité de la magnitude des deux vecteurs)
      * @param[in] pos : Vecteur avec lequel vérifier la stricte supériorité
-     * @fn bool operator>(const Vec2D& pos) const;
+     * @fn constexpr bool operator>(const Vec2D& pos) const;
      */
-    bool operator>(const Vec2D& pos) const;
+    constexpr bool operator>(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur d'infériorité
      * (Vérifie l'infériorité de la magnitude des deux vecteurs)
      * @param[in] pos : Vecteur avec lequel vérifier l'infériorité
-     * @fn bool operator<=(const Vec2D& pos) const;
+     * @fn constexpr bool operator<=(const Vec2D& pos) const;
      */
-    bool operator<=(const Vec2D& pos) const;
+    constexpr bool operator<=(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur de supériorité
      * (Vérifie la supériorité de la magnitude des deux vecteurs)
      * @param[in] pos : Vecteur avec lequel vérifier la supériorité
-     * @fn bool operator>=(const Vec2D& pos) const;
+     * @fn constexpr bool operator>=(const Vec2D& pos) const;
      */
-    bool operator>=(const Vec2D& pos) const;
+    constexpr bool operator>=(const Vec2D& pos) const;
 
     /**
      * @brief Opérateur d'assignement
      * @param[in] pos : Vecteur source
-     * @fn Vec2D& operator=(const Vec2D& pos);
+     * @fn Vec2D& operator=(const Vec2D& pos) = default;
      */
-    Vec2D& operator=(const Vec2D& pos);
+    Vec2D& operator=(const Vec2D& pos) = default;
 
     /**
      * @brief Opérateur d'addition avec assignement
@@ -194,25 +199,25 @@ public:
      * @brief Retourne le vecteur le plus petit entre les deux passés en argument
      * @param[in] p1 : Premier vecteur
      * @param[in] p2 : Second vecteur
-     * @fn static Vec2D min(const Vec2D& p1, const Vec2D& p2);
+     * @fn static constexpr Vec2D min(const Vec2D& p1, const Vec2D& p2);
      */
-    static Vec2D min(const Vec2D& p1, const Vec2D& p2);
+    static constexpr Vec2D min(const Vec2D& p1, const Vec2D& p2);
 
     /**
      * @brief Retourne vrai si le premier vecteur est le plus petit des deux
      * @param[in] p1 : Premier vecteur
      * @param[in] p2 : Second vecteur
-     * @fn static bool minf(const Vec2D& p1, const Vec2D& p2);
+     * @fn static constexpr bool minf(const Vec2D& p1, const Vec2D& p2);
      */
-    static bool minf(const Vec2D& p1, const Vec2D& p2);
+    static constexpr bool minf(const Vec2D& p1, const Vec2D& p2);
 
     /**
-     * @brief Retourne vrai si le vecteur actuel est compris entre deux vecteurs formant un rectangle
+     * @brief Retourne vrai si le vecteur actuel est compris entre deux vecteurs formant un rectangle, bords inclus
      * @param[in] firstCorner : Premier vecteur
      * @param[in] secondCorner : Second vecteur
-     * @fn bool isColliding(Vec2D firstCorner, Vec2D secondCorner) const;
+     * @fn constexpr bool isColliding(const Vec2D& firstCorner, const Vec2D& secondCorner) const;
      */
-    bool isColliding(Vec2D firstCorner, Vec2D secondCorner) const;
+    constexpr bool isColliding(const Vec2D& firstCorner, const Vec2D& secondCorner) const;
 
     /**
      * @brief Calcule la magnitude de ce vecteur
@@ -221,12 +226,19 @@ public:
      */
     double computeMagnitude() const;
 
+    /**
+     * @brief Calcule le carré de la magnitude de ce vecteur, sans racine carrée
+     * @return Carré de la magnitude du vecteur
+     * @fn constexpr long long computeSquaredMagnitude() const;
+     */
+    constexpr long long computeSquaredMagnitude() const;
+
     /**
      * @brief Récupère la position X (abscisse)
-     * @return Une référence constante vers m_x
-     * @fn int getX() const;
+     * @return La position X
+     * @fn constexpr int getX() const;
      */
-    int getX() const;
+    constexpr int getX() const;
 
     /**
      * @brief Définit la nouvelle position X (abscisse)
@@ -237,10 +249,10 @@ public:
 
     /**
      * @brief Récupère la position Y (ordonnée)
-     * @return Une référence constante vers m_y
-     * @fn int getY() const;
+     * @return La position Y
+     * @fn constexpr int getY() const;
      */
-    int getY() const;
+    constexpr int getY() const;
 
     /**
      * @brief Définit la nouvelle position Y (ordonnée)
@@ -249,9 +261,6 @@ public:
      */
     void setY(int y);
 
-protected:
-    virtual std::ostream& _Edit(std::ostream& os = std::cout) const override;
-
 private:
     /**
      * @brief m_x : Position X (abscisse)
@@ -265,6 +274,16 @@ private:
 
 }; // class Vec2D
 
+/**
+ * @brief Écrit un vecteur dans un flux, sous la forme "X: x, Y: y"
+ * @param[in, out] os : Flux de sortie
+ * @param[in] pos : Vecteur a écrire
+ * @fn std::ostream& operator<<(std::ostream& os, const Vec2D& pos);
+ */
+std::ostream& operator<<(std::ostream& os, const Vec2D& pos);
+
 } // namespace nsGraphics
 
+#include "vec2d.hpp"
+
 #endif // VEC2D_H
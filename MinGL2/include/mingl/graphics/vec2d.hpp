@@ -0,0 +1,197 @@
+/**
+ *
+ * @file    vec2d.hpp
+ * @author  Alexandre Sollier
+ * @date    Septembre 2020
+ * @version 1.4
+ * @brief   Représente un vecteur sur deux dimensions
+ *
+ **/
+
+#ifndef VEC2D_HPP
+#define VEC2D_HPP
+
+#include <cmath>
+#include <type_traits>
+
+#include "vec2d.h"
+
+constexpr nsGraphics::Vec2D::Vec2D(const int& x /* = 0 */, const int& y /* = 0 */)
+    : m_x(x)
+    , m_y(y)
+{} // Vec2D()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator+() const
+{
+    return Vec2D(+m_x, +m_y);
+} // operator+()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator-() const
+{
+    return Vec2D(-m_x, -m_y);
+} // operator-()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator+(const Vec2D& pos) const
+{
+    return Vec2D(m_x + pos.getX(), m_y + pos.getY());
+} // operator+()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator-(const Vec2D &pos) const
+{
+    return Vec2D(m_x - pos.getX(), m_y - pos.getY());
+} // operator-()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator*(const Vec2D& pos) const
+{
+    return Vec2D(m_x * pos.getX(), m_y * pos.getY());
+} // operator*()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator*(const float& n) const
+{
+    return Vec2D(m_x * n, m_y * n);
+} // operator*()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator/(const Vec2D &pos) const
+{
+    return Vec2D(m_x / pos.getX(), m_y / pos.getY());
+} // operator/()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator/(const float &n) const
+{
+    return Vec2D(m_x / n, m_y / n);
+} // operator/()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::operator%(const Vec2D &pos) const
+{
+    return Vec2D(m_x % pos.getX(), m_y % pos.getY());
+} // operator%()
+
+constexpr bool nsGraphics::Vec2D::operator==(const Vec2D& pos) const
+{
+    return m_x == pos.getX() && m_y == pos.getY();
+} // operator==()
+
+constexpr bool nsGraphics::Vec2D::operator!=(const Vec2D &pos) const
+{
+    return m_x != pos.getX() || m_y != pos.getY();
+} // operator!=()
+
+constexpr bool nsGraphics::Vec2D::operator<(const Vec2D& pos) const
+{
+    return computeSquaredMagnitude() < pos.computeSquaredMagnitude();
+} // operator<()
+
+constexpr bool nsGraphics::Vec2D::operator>(const Vec2D& pos) const
+{
+    return computeSquaredMagnitude() > pos.computeSquaredMagnitude();
+} // operator>()
+
+constexpr bool nsGraphics::Vec2D::operator<=(const Vec2D& pos) const
+{
+    return computeSquaredMagnitude() <= pos.computeSquaredMagnitude();
+} // operator<=()
+
+constexpr bool nsGraphics::Vec2D::operator>=(const Vec2D& pos) const
+{
+    return computeSquaredMagnitude() >= pos.computeSquaredMagnitude();
+} // operator>=()
+
+inline nsGraphics::Vec2D& nsGraphics::Vec2D::operator+=(const Vec2D& pos)
+{
+    m_x += pos.getX();
+    m_y += pos.getY();
+
+    return *this;
+} // operator+=()
+
+inline nsGraphics::Vec2D &nsGraphics::Vec2D::operator-=(const nsGraphics::Vec2D &pos)
+{
+    m_x -= pos.getX();
+    m_y -= pos.getY();
+
+    return *this;
+} // operator-=()
+
+inline nsGraphics::Vec2D &nsGraphics::Vec2D::operator*=(const nsGraphics::Vec2D &pos)
+{
+    m_x *= pos.getX();
+    m_y *= pos.getY();
+
+    return *this;
+} // operator*=()
+
+inline nsGraphics::Vec2D &nsGraphics::Vec2D::operator/=(const nsGraphics::Vec2D &pos)
+{
+    m_x /= pos.getX();
+    m_y /= pos.getY();
+
+    return *this;
+} // operator/=()
+
+inline nsGraphics::Vec2D &nsGraphics::Vec2D::operator%=(const nsGraphics::Vec2D &pos)
+{
+    m_x %= pos.getX();
+    m_y %= pos.getY();
+
+    return *this;
+} // operator%=()
+
+constexpr nsGraphics::Vec2D nsGraphics::Vec2D::min(const Vec2D& p1, const Vec2D& p2)
+{
+    return (p1.getX() < p2.getX() || (p1.getX() == p2.getX() && p1.getY() < p2.getY())) ? p1 : p2;
+} // min()
+
+constexpr bool nsGraphics::Vec2D::minf(const Vec2D& p1, const Vec2D& p2)
+{
+    return (p1 == min(p1, p2));
+} // minf()
+
+constexpr bool nsGraphics::Vec2D::isColliding(const Vec2D& firstCorner, const Vec2D& secondCorner) const
+{
+    // Chaque coordonnée doit être entre celles des deux coins, quel que soit leur ordre :
+    // les deux écarts sont alors de signes opposés (ou nuls), sans branchement
+    return (((long long)(m_x) - firstCorner.m_x) * ((long long)(m_x) - secondCorner.m_x) <= 0)
+         & (((long long)(m_y) - firstCorner.m_y) * ((long long)(m_y) - secondCorner.m_y) <= 0);
+} // isColliding()
+
+inline double nsGraphics::Vec2D::computeMagnitude() const
+{
+    return std::sqrt(double(computeSquaredMagnitude()));
+} // getMagnitude()
+
+constexpr long long nsGraphics::Vec2D::computeSquaredMagnitude() const
+{
+    return (long long)(m_x) * m_x + (long long)(m_y) * m_y;
+} // computeSquaredMagnitude()
+
+constexpr int nsGraphics::Vec2D::getX() const
+{
+    return m_x;
+} // getX()
+
+inline void nsGraphics::Vec2D::setX(int x)
+{
+    m_x = x;
+} // setX()
+
+constexpr int nsGraphics::Vec2D::getY() const
+{
+    return m_y;
+} // getY()
+
+inline void nsGraphics::Vec2D::setY(int y)
+{
+    m_y = y;
+} // setY()
+
+inline std::ostream& nsGraphics::operator<<(std::ostream& os, const Vec2D& pos)
+{
+    os << "X: " << pos.getX() << ", Y: " << pos.getY();
+    return os;
+} // operator<<()
+
+static_assert(std::is_trivially_copyable<nsGraphics::Vec2D>::value, "Vec2D must stay trivially copyable");
+static_assert(std::is_standard_layout<nsGraphics::Vec2D>::value && sizeof(nsGraphics::Vec2D) == 2 * sizeof(int),
+              "Vec2D must stay laid out as two ints");
+
+#endif // VEC2D_HPP
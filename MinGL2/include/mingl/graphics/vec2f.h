@@ -0,0 +1,262 @@
+/**
+ *
+ * @file    vec2f.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Représente un vecteur sur deux dimensions, avec une précision inférieure au pixel
+ *
+ **/
+
+#ifndef VEC2F_H
+#define VEC2F_H
+
+#include <cstdint>
+#include <ostream>
+
+#include "vec2d.h"
+
+namespace nsGraphics
+{
+
+/**
+ * @class Fixed16
+ * @brief Nombre a virgule fixe 16.16 : 16 bits de partie entière signée, 16 bits de partie fractionnaire
+ *
+ * Les calculs se font uniquement sur des entiers : ils donnent le même résultat quel que soit le compilateur
+ * ou les options d'optimisation, ce qui permet de rejouer une partie a l'identique.
+ * La plage couverte va de -32768 a 32767,99998 avec un pas de 1/65536.
+ */
+class Fixed16
+{
+public:
+    /**
+     * @brief Constantes de la représentation
+     */
+    enum : int32_t {
+        KFractionBits = 16,          /**< Nombre de bits de la partie fractionnaire */
+        KOne = 1 << KFractionBits,   /**< Valeur brute de 1 */
+    };
+
+    /**
+     * @brief Constructeur pour la classe Fixed16
+     * @param[in] value : Valeur entière
+     * @fn constexpr Fixed16(const int& value = 0);
+     */
+    constexpr Fixed16(const int& value = 0);
+
+    /**
+     * @brief Constructeur pour la classe Fixed16, a partir d'un flottant arrondi au pas le plus proche
+     * @param[in] value : Valeur flottante
+     * @fn explicit constexpr Fixed16(const double& value);
+     */
+    explicit constexpr Fixed16(const double& value);
+
+    /**
+     * @brief Construit un nombre a partir de sa valeur brute
+     * @param[in] raw : Valeur brute, soit la valeur multipliée par KOne
+     * @fn static constexpr Fixed16 fromRaw(const int32_t& raw);
+     */
+    static constexpr Fixed16 fromRaw(const int32_t& raw);
+
+    /**
+     * @brief Construit le nombre numerator / denominator, tronqué vers zéro
+     * @param[in] numerator : Numérateur
+     * @param[in] denominator : Dénominateur, non nul
+     * @fn static constexpr Fixed16 fromRatio(const long long& numerator, const long long& denominator);
+     *
+     * Permet par exemple de convertir une durée entière en secondes sans passer par un flottant.
+     */
+    static constexpr Fixed16 fromRatio(const long long& numerator, const long long& denominator);
+
+    /**
+     * @brief Récupère la valeur brute
+     * @fn constexpr int32_t getRaw() const;
+     */
+    constexpr int32_t getRaw() const;
+
+    /**
+     * @brief Arrondit a l'entier le plus proche (les demis vers +infini)
+     * @fn constexpr int round() const;
+     */
+    constexpr int round() const;
+
+    /**
+     * @brief Convertit en flottant
+     * @fn constexpr float toFloat() const;
+     */
+    constexpr float toFloat() const;
+
+    constexpr Fixed16 operator+() const;
+    constexpr Fixed16 operator-() const;
+    constexpr Fixed16 operator+(const Fixed16& other) const;
+    constexpr Fixed16 operator-(const Fixed16& other) const;
+    constexpr Fixed16 operator*(const Fixed16& other) const;
+    constexpr Fixed16 operator/(const Fixed16& other) const;
+    constexpr bool operator==(const Fixed16& other) const;
+    constexpr bool operator!=(const Fixed16& other) const;
+    constexpr bool operator<(const Fixed16& other) const;
+    constexpr bool operator>(const Fixed16& other) const;
+    constexpr bool operator<=(const Fixed16& other) const;
+    constexpr bool operator>=(const Fixed16& other) const;
+    Fixed16& operator+=(const Fixed16& other);
+    Fixed16& operator-=(const Fixed16& other);
+    Fixed16& operator*=(const Fixed16& other);
+    Fixed16& operator/=(const Fixed16& other);
+
+private:
+    /**
+     * @brief Étiquette du constructeur a partir d'une valeur brute
+     */
+    struct RawTag {};
+
+    /**
+     * @brief Constructeur a partir d'une valeur brute
+     * @fn constexpr Fixed16(const int32_t& raw, RawTag);
+     */
+    constexpr Fixed16(const int32_t& raw, RawTag);
+
+    /**
+     * @brief m_raw : Valeur multipliée par KOne
+     */
+    int32_t m_raw;
+
+}; // class Fixed16
+
+/**
+ * @brief Arrondit un nombre a l'entier le plus proche
+ * @param[in] value : Nombre a arrondir
+ * @fn int roundToInt(const Fixed16& value);
+ */
+int roundToInt(const Fixed16& value);
+
+/**
+ * @brief Arrondit un nombre a l'entier le plus proche
+ * @param[in] value : Nombre a arrondir
+ * @fn int roundToInt(const float& value);
+ */
+int roundToInt(const float& value);
+
+/**
+ * @brief Construit le nombre numerator / denominator dans le type T (Fixed16 ou float)
+ * @param[in] numerator : Numérateur
+ * @param[in] denominator : Dénominateur, non nul
+ * @fn template <typename T> T scalarFromRatio(const long long& numerator, const long long& denominator);
+ */
+template <typename T>
+T scalarFromRatio(const long long& numerator, const long long& denominator);
+
+/**
+ * @class BasicVec2
+ * @brief Vecteur deux-dimensionnel a composantes fractionnaires, pour simuler un mouvement plus fin que le pixel
+ * @tparam T : Type des composantes, Fixed16 ou float
+ *
+ * Les positions sont simulées dans ce type, puis arrondies en Vec2D seulement pour l'affichage.
+ */
+template <typename T>
+class BasicVec2
+{
+public:
+    /**
+     * @brief Scalar_t : Type des composantes
+     */
+    typedef T Scalar_t;
+
+    /**
+     * @brief Constructeur pour la classe BasicVec2
+     * @param[in] x : Position X (abscisse) du vecteur
+     * @param[in] y : Position Y (ordonnée) du vecteur
+     * @fn constexpr BasicVec2(const T& x = T(), const T& y = T());
+     */
+    constexpr BasicVec2(const T& x = T(), const T& y = T());
+
+    /**
+     * @brief Constructeur pour la classe BasicVec2, a partir d'un vecteur entier
+     * @param[in] pos : Vecteur entier
+     * @fn explicit constexpr BasicVec2(const Vec2D& pos);
+     */
+    explicit constexpr BasicVec2(const Vec2D& pos);
+
+    /**
+     * @brief Arrondit chaque composante au pixel le plus proche
+     * @fn Vec2D toVec2D() const;
+     */
+    Vec2D toVec2D() const;
+
+    constexpr BasicVec2 operator-() const;
+    constexpr BasicVec2 operator+(const BasicVec2& pos) const;
+    constexpr BasicVec2 operator-(const BasicVec2& pos) const;
+    constexpr BasicVec2 operator*(const T& n) const;
+    constexpr BasicVec2 operator/(const T& n) const;
+    constexpr bool operator==(const BasicVec2& pos) const;
+    constexpr bool operator!=(const BasicVec2& pos) const;
+    BasicVec2& operator+=(const BasicVec2& pos);
+    BasicVec2& operator-=(const BasicVec2& pos);
+
+    /**
+     * @brief Récupère la position X (abscisse)
+     * @fn constexpr T getX() const;
+     */
+    constexpr T getX() const;
+
+    /**
+     * @brief Définit la nouvelle position X (abscisse)
+     * @param[in] x : Nouvelle position X
+     * @fn void setX(const T& x);
+     */
+    void setX(const T& x);
+
+    /**
+     * @brief Récupère la position Y (ordonnée)
+     * @fn constexpr T getY() const;
+     */
+    constexpr T getY() const;
+
+    /**
+     * @brief Définit la nouvelle position Y (ordonnée)
+     * @param[in] y : Nouvelle position Y
+     * @fn void setY(const T& y);
+     */
+    void setY(const T& y);
+
+private:
+    /**
+     * @brief m_x : Position X (abscisse)
+     */
+    T m_x;
+
+    /**
+     * @brief m_y : Position Y (ordonnée)
+     */
+    T m_y;
+
+}; // class BasicVec2
+
+/**
+ * @brief Vec2F : Vecteur utilisé pour la simulation, en virgule fixe par défaut
+ *
+ * Définir MINGL_FLOAT_VEC2F le fait passer en float, au prix du déterminisme entre compilateurs.
+ */
+#ifdef MINGL_FLOAT_VEC2F
+typedef BasicVec2<float> Vec2F;
+#else
+typedef BasicVec2<Fixed16> Vec2F;
+#endif
+
+/**
+ * @brief Écrit un nombre a virgule fixe dans un flux, sous forme décimale
+ * @fn std::ostream& operator<<(std::ostream& os, const Fixed16& value);
+ */
+std::ostream& operator<<(std::ostream& os, const Fixed16& value);
+
+/**
+ * @brief Écrit un vecteur dans un flux, sous la forme "X: x, Y: y"
+ * @fn template <typename T> std::ostream& operator<<(std::ostream& os, const BasicVec2<T>& pos);
+ */
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const BasicVec2<T>& pos);
+
+} // namespace nsGraphics
+
+#include "vec2f.hpp"
+
+#endif // VEC2F_H
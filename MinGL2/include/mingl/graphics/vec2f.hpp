@@ -0,0 +1,284 @@
+/**
+ *
+ * @file    vec2f.hpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Représente un vecteur sur deux dimensions, avec une précision inférieure au pixel
+ *
+ **/
+
+#ifndef VEC2F_HPP
+#define VEC2F_HPP
+
+#include <cmath>
+#include <type_traits>
+
+#include "vec2f.h"
+
+constexpr nsGraphics::Fixed16::Fixed16(const int& value /* = 0 */)
+    : m_raw(value * KOne)
+{} // Fixed16()
+
+constexpr nsGraphics::Fixed16::Fixed16(const double& value)
+    : m_raw(int32_t(value * KOne + (value < 0 ? -0.5 : 0.5)))
+{} // Fixed16()
+
+constexpr nsGraphics::Fixed16::Fixed16(const int32_t& raw, RawTag)
+    : m_raw(raw)
+{} // Fixed16()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::fromRaw(const int32_t& raw)
+{
+    return Fixed16(raw, RawTag());
+} // fromRaw()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::fromRatio(const long long& numerator, const long long& denominator)
+{
+    return Fixed16(int32_t(numerator * KOne / denominator), RawTag());
+} // fromRatio()
+
+constexpr int32_t nsGraphics::Fixed16::getRaw() const
+{
+    return m_raw;
+} // getRaw()
+
+constexpr int nsGraphics::Fixed16::round() const
+{
+    // Le décalage a droite d'un négatif est arithmétique sur tous les compilateurs visés : il arrondit vers -infini
+    return (m_raw + KOne / 2) >> KFractionBits;
+} // round()
+
+constexpr float nsGraphics::Fixed16::toFloat() const
+{
+    return float(m_raw) / KOne;
+} // toFloat()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::operator+() const
+{
+    return *this;
+} // operator+()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::operator-() const
+{
+    return Fixed16(-m_raw, RawTag());
+} // operator-()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::operator+(const Fixed16& other) const
+{
+    return Fixed16(m_raw + other.m_raw, RawTag());
+} // operator+()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::operator-(const Fixed16& other) const
+{
+    return Fixed16(m_raw - other.m_raw, RawTag());
+} // operator-()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::operator*(const Fixed16& other) const
+{
+    return Fixed16(int32_t((int64_t(m_raw) * other.m_raw) >> KFractionBits), RawTag());
+} // operator*()
+
+constexpr nsGraphics::Fixed16 nsGraphics::Fixed16::operator/(const Fixed16& other) const
+{
+    return Fixed16(int32_t(int64_t(m_raw) * KOne / other.m_raw), RawTag());
+} // operator/()
+
+constexpr bool nsGraphics::Fixed16::operator==(const Fixed16& other) const
+{
+    return m_raw == other.m_raw;
+} // operator==()
+
+constexpr bool nsGraphics::Fixed16::operator!=(const Fixed16& other) const
+{
+    return m_raw != other.m_raw;
+} // operator!=()
+
+constexpr bool nsGraphics::Fixed16::operator<(const Fixed16& other) const
+{
+    return m_raw < other.m_raw;
+} // operator<()
+
+constexpr bool nsGraphics::Fixed16::operator>(const Fixed16& other) const
+{
+    return m_raw > other.m_raw;
+} // operator>()
+
+constexpr bool nsGraphics::Fixed16::operator<=(const Fixed16& other) const
+{
+    return m_raw <= other.m_raw;
+} // operator<=()
+
+constexpr bool nsGraphics::Fixed16::operator>=(const Fixed16& other) const
+{
+    return m_raw >= other.m_raw;
+} // operator>=()
+
+inline nsGraphics::Fixed16& nsGraphics::Fixed16::operator+=(const Fixed16& other)
+{
+    return *this = *this + other;
+} // operator+=()
+
+inline nsGraphics::Fixed16& nsGraphics::Fixed16::operator-=(const Fixed16& other)
+{
+    return *this = *this - other;
+} // operator-=()
+
+inline nsGraphics::Fixed16& nsGraphics::Fixed16::operator*=(const Fixed16& other)
+{
+    return *this = *this * other;
+} // operator*=()
+
+inline nsGraphics::Fixed16& nsGraphics::Fixed16::operator/=(const Fixed16& other)
+{
+    return *this = *this / other;
+} // operator/=()
+
+inline int nsGraphics::roundToInt(const Fixed16& value)
+{
+    return value.round();
+} // roundToInt()
+
+inline int nsGraphics::roundToInt(const float& value)
+{
+    return int(std::floor(value + 0.5f));
+} // roundToInt()
+
+namespace nsGraphics
+{
+
+template <>
+inline Fixed16 scalarFromRatio<Fixed16>(const long long& numerator, const long long& denominator)
+{
+    return Fixed16::fromRatio(numerator, denominator);
+} // scalarFromRatio()
+
+template <>
+inline float scalarFromRatio<float>(const long long& numerator, const long long& denominator)
+{
+    return float(numerator) / float(denominator);
+} // scalarFromRatio()
+
+} // namespace nsGraphics
+
+template <typename T>
+constexpr nsGraphics::BasicVec2<T>::BasicVec2(const T& x /* = T() */, const T& y /* = T() */)
+    : m_x(x)
+    , m_y(y)
+{} // BasicVec2()
+
+template <typename T>
+constexpr nsGraphics::BasicVec2<T>::BasicVec2(const Vec2D& pos)
+    : m_x(T(pos.getX()))
+    , m_y(T(pos.getY()))
+{} // BasicVec2()
+
+template <typename T>
+inline nsGraphics::Vec2D nsGraphics::BasicVec2<T>::toVec2D() const
+{
+    return Vec2D(roundToInt(m_x), roundToInt(m_y));
+} // toVec2D()
+
+template <typename T>
+constexpr nsGraphics::BasicVec2<T> nsGraphics::BasicVec2<T>::operator-() const
+{
+    return BasicVec2(-m_x, -m_y);
+} // operator-()
+
+template <typename T>
+constexpr nsGraphics::BasicVec2<T> nsGraphics::BasicVec2<T>::operator+(const BasicVec2& pos) const
+{
+    return BasicVec2(m_x + pos.m_x, m_y + pos.m_y);
+} // operator+()
+
+template <typename T>
+constexpr nsGraphics::BasicVec2<T> nsGraphics::BasicVec2<T>::operator-(const BasicVec2& pos) const
+{
+    return BasicVec2(m_x - pos.m_x, m_y - pos.m_y);
+} // operator-()
+
+template <typename T>
+constexpr nsGraphics::BasicVec2<T> nsGraphics::BasicVec2<T>::operator*(const T& n) const
+{
+    return BasicVec2(m_x * n, m_y * n);
+} // operator*()
+
+template <typename T>
+constexpr nsGraphics::BasicVec2<T> nsGraphics::BasicVec2<T>::operator/(const T& n) const
+{
+    return BasicVec2(m_x / n, m_y / n);
+} // operator/()
+
+template <typename T>
+constexpr bool nsGraphics::BasicVec2<T>::operator==(const BasicVec2& pos) const
+{
+    return m_x == pos.m_x && m_y == pos.m_y;
+} // operator==()
+
+template <typename T>
+constexpr bool nsGraphics::BasicVec2<T>::operator!=(const BasicVec2& pos) const
+{
+    return m_x != pos.m_x || m_y != pos.m_y;
+} // operator!=()
+
+template <typename T>
+inline nsGraphics::BasicVec2<T>& nsGraphics::BasicVec2<T>::operator+=(const BasicVec2& pos)
+{
+    m_x += pos.m_x;
+    m_y += pos.m_y;
+
+    return *this;
+} // operator+=()
+
+template <typename T>
+inline nsGraphics::BasicVec2<T>& nsGraphics::BasicVec2<T>::operator-=(const BasicVec2& pos)
+{
+    m_x -= pos.m_x;
+    m_y -= pos.m_y;
+
+    return *this;
+} // operator-=()
+
+template <typename T>
+constexpr T nsGraphics::BasicVec2<T>::getX() const
+{
+    return m_x;
+} // getX()
+
+template <typename T>
+inline void nsGraphics::BasicVec2<T>::setX(const T& x)
+{
+    m_x = x;
+} // setX()
+
+template <typename T>
+constexpr T nsGraphics::BasicVec2<T>::getY() const
+{
+    return m_y;
+} // getY()
+
+template <typename T>
+inline void nsGraphics::BasicVec2<T>::setY(const T& y)
+{
+    m_y = y;
+} // setY()
+
+inline std::ostream& nsGraphics::operator<<(std::ostream& os, const Fixed16& value)
+{
+    os << value.toFloat();
+    return os;
+} // operator<<()
+
+template <typename T>
+inline std::ostream& nsGraphics::operator<<(std::ostream& os, const BasicVec2<T>& pos)
+{
+    os << "X: " << pos.getX() << ", Y: " << pos.getY();
+    return os;
+} // operator<<()
+
+static_assert(std::is_trivially_copyable<nsGraphics::Fixed16>::value && sizeof(nsGraphics::Fixed16) == sizeof(int32_t),
+              "Fixed16 must stay a plain 32-bit value");
+static_assert(std::is_trivially_copyable<nsGraphics::Vec2F>::value, "Vec2F must stay trivially copyable");
+static_assert(nsGraphics::Fixed16(3) * nsGraphics::Fixed16(0.5) == nsGraphics::Fixed16(1.5), "Fixed16 product");
+static_assert(nsGraphics::Fixed16(-2.5).round() == -2 && nsGraphics::Fixed16(2.5).round() == 3, "Fixed16 rounding");
+
+#endif // VEC2F_HPP
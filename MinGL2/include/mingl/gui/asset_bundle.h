@@ -0,0 +1,193 @@
+/**
+ *
+ * @file    asset_bundle.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Fichiers rangés dans un seul paquet, projeté en mémoire
+ *
+ **/
+
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sprite.h"
+
+namespace nsGui {
+
+/**
+ * @class AssetBundle
+ * @brief Projette en mémoire un paquet créé par tools/si2bundle.py, et sert son contenu par nom sans le copier
+ *
+ * Le paquet commence par un en-tête, suivi d'un index des fichiers trié par nom, puis du contenu de chaque fichier,
+ * aligné (voir tools/si2bundle.py pour le détail du format). Il est projeté une seule fois avec mmap() :
+ * seules les pages réellement lues sont chargées, et les sprites servis lisent leurs pixels directement dans
+ * la projection, qu'ils gardent en vie.
+ */
+class AssetBundle
+{
+public:
+    /**
+     * @struct Blob
+     * @brief Contenu d'un fichier du paquet
+     */
+    struct Blob {
+        const uint8_t* data; /**< Premier octet du fichier, dans la projection */
+        size_t size; /**< Taille du fichier, en octets */
+    };
+
+    /**
+     * @brief Constructeur pour la classe AssetBundle, projette le paquet en mémoire et vérifie son index
+     * @param[in] filename : Chemin d'accès vers le paquet
+     * @fn AssetBundle(const std::string& filename);
+     *
+     * Lance une CException (KFileError) si le paquet ne peut être ouvert ou n'est pas valide.
+     */
+    AssetBundle(const std::string& filename);
+
+    /**
+     * @brief Constructeur pour la classe AssetBundle, lit un paquet déjà en mémoire, par exemple compilé dans l'exécutable
+     * @param[in] data : Début du paquet, aligné comme son contenu (voir tools/si2embed.py)
+     * @param[in] size : Taille du paquet, en octets
+     * @fn AssetBundle(const void* data, const size_t& size);
+     *
+     * Rien n'est copié ni gardé en vie : la mémoire doit durer plus longtemps que le paquet et les sprites servis,
+     * ce qui est le cas d'un tableau statique. Lance une CException (KErrArg) si le paquet n'est pas valide.
+     */
+    AssetBundle(const void* data, const size_t& size);
+
+    /**
+     * @brief Retourne vrai si le paquet contient un fichier de ce nom
+     * @param[in] name : Nom du fichier, chemin relatif au dossier d'origine
+     * @fn bool contains(const std::string& name) const;
+     */
+    bool contains(const std::string& name) const;
+
+    /**
+     * @brief Récupère le contenu d'un fichier du paquet
+     * @param[in] name : Nom du fichier, chemin relatif au dossier d'origine
+     * @fn Blob getBlob(const std::string& name) const;
+     *
+     * Le contenu reste valide tant que le paquet ou un sprite qu'il a servi existe.
+     * Lance une CException (KErrArg) si le paquet ne contient pas de fichier de ce nom.
+     */
+    Blob getBlob(const std::string& name) const;
+
+    /**
+     * @brief Crée un sprite depuis un .si2 du paquet, sans copier ses pixels
+     * @param[in] name : Nom du fichier, chemin relatif au dossier d'origine
+     * @param[in] position : Position du sprite
+     * @param[in] alphaMode : Mode de stockage des pixels
+     * @fn Sprite getSprite(const std::string& name, const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const Sprite::AlphaMode& alphaMode = Sprite::ALPHA_STRAIGHT) const;
+     *
+     * Lance une CException (KErrArg) si le paquet ne contient pas de fichier de ce nom, ou s'il n'est pas un .si2 valide.
+     */
+    Sprite getSprite(const std::string& name, const nsGraphics::Vec2D& position = nsGraphics::Vec2D(),
+                     const Sprite::AlphaMode& alphaMode = Sprite::ALPHA_STRAIGHT) const;
+
+    /**
+     * @brief Charge en mémoire toutes les pages d'un fichier du paquet, en lisant un octet de chacune
+     * @param[in] name : Nom du fichier, chemin relatif au dossier d'origine
+     * @fn void prefault(const std::string& name) const;
+     *
+     * Un sprite servi par le paquet ne lit ses pixels qu'a son premier affichage, qui attend alors le disque.
+     * Appelée depuis un thread de chargement, cette fonction fait cette attente a l'avance, sans bloquer l'affichage.
+     * Lance une CException (KErrArg) si le paquet ne contient pas de fichier de ce nom.
+     */
+    void prefault(const std::string& name) const;
+
+    /**
+     * @brief Rend au système les pages d'un fichier du paquet, que le prochain accès relira depuis le disque ou le cache
+     * @param[in] name : Nom du fichier, chemin relatif au dossier d'origine
+     * @fn void discard(const std::string& name) const;
+     *
+     * Inverse de prefault(), pour un fichier qui ne sera plus affiché avant longtemps : le paquet n'étant jamais modifié,
+     * aucune donnée n'est perdue. Seules les pages entièrement occupées par le fichier sont rendues.
+     * Lance une CException (KErrArg) si le paquet ne contient pas de fichier de ce nom.
+     */
+    void discard(const std::string& name) const;
+
+    /**
+     * @brief Récupère le nom de tous les fichiers du paquet, triés
+     * @fn std::vector<std::string> getNames() const;
+     */
+    std::vector<std::string> getNames() const;
+
+    /**
+     * @brief Récupère la taille du paquet, en octets
+     * @return Une référence constante vers m_size
+     * @fn const size_t& getSize() const;
+     */
+    const size_t& getSize() const;
+
+private:
+    /**
+     * @brief Longueur maximale du nom d'un fichier, zéro final compris
+     */
+    static constexpr size_t KNameSize = 32;
+
+    /**
+     * @struct FileBegin
+     * @brief Décrit l'en-tête d'un paquet
+     */
+    struct FileBegin {
+        uint32_t magic; /**< Le magic number du paquet, doit toujours être "SI2B" */
+        uint16_t version; /**< La version du format stockée par le paquet */
+        uint16_t entryCount; /**< Le nombre de fichiers dans l'index */
+        uint32_t alignment; /**< L'alignement du contenu de chaque fichier, en octets */
+        uint32_t fileSize; /**< La taille totale du paquet, en octets */
+    } __attribute__((packed));
+
+    /**
+     * @struct Entry
+     * @brief Décrit un fichier dans l'index du paquet
+     */
+    struct Entry {
+        char name[KNameSize]; /**< Le nom du fichier, complété par des zéros */
+        uint32_t offset; /**< La position du contenu depuis le début du paquet */
+        uint32_t size; /**< La taille du contenu, en octets */
+    } __attribute__((packed));
+
+    /**
+     * @brief Cherche un fichier dans l'index, par dichotomie
+     * @param[in] name : Nom du fichier
+     * @return L'entrée du fichier, nulle s'il n'existe pas
+     * @fn const Entry* findEntry(const std::string& name) const;
+     */
+    const Entry* findEntry(const std::string& name) const;
+
+    /**
+     * @brief Vérifie l'en-tête, l'ordre de l'index et les bornes de chaque fichier, puis retient l'index
+     * @return Faux si le paquet n'est pas valide
+     * @fn bool readIndex();
+     */
+    bool readIndex();
+
+    /**
+     * @brief m_mapping : Projection du paquet en mémoire, partagée avec les sprites servis (sans propriétaire pour un paquet statique)
+     */
+    std::shared_ptr<const void> m_mapping;
+
+    /**
+     * @brief m_size : Taille du paquet, en octets
+     */
+    size_t m_size = 0;
+
+    /**
+     * @brief m_entries : Index du paquet, dans la projection
+     */
+    const Entry* m_entries = nullptr;
+
+    /**
+     * @brief m_entryCount : Nombre de fichiers dans l'index
+     */
+    size_t m_entryCount = 0;
+}; // class AssetBundle
+
+} // namespace nsGui
+
+#endif // ASSET_BUNDLE_H
@@ -12,9 +12,11 @@
 #define DISPLAY_SPRITE_H
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "../graphics/idrawable.h"
+#include "../graphics/rect.h"
 #include "../graphics/rgbacolor.h"
 #include "../graphics/vec2d.h"
 #include "../transition/itransitionable.h"
@@ -24,6 +26,15 @@ namespace nsGui {
 /**
  * @class Sprite
  * @brief Permet de charger une image depuis un format créé pour l'occasion, le .si2
+ *
+ * Un sprite stocke ses pixels soit directement en RGBA (.si2 version 1), soit sous forme indexée (.si2 version 2) :
+ * une palette de 256 couleurs au plus, et un octet par pixel donnant sa couleur dans la palette.
+ * Un sprite indexé prend environ quatre fois moins de mémoire, et changer sa palette recolore tout le sprite
+ * sans toucher a ses pixels (teinte de dégâts, couleurs par rangée...).
+ *
+ * Un sprite peut aussi n'être qu'une vue sur une zone d'un autre sprite, sans pixels a lui : c'est ainsi que
+ * SpriteAtlas sert les images rangées dans une même page. De même, un sprite créé depuis un .si2 déjà en mémoire
+ * (AssetBundle) lit ses pixels directement dans cette mémoire.
  */
 class Sprite : public nsGraphics::IDrawable, public nsTransition::ITransitionable
 {
@@ -35,27 +46,99 @@ public:
         TRANSITION_POSITION, /**< Transition pour la position */
     };
 
+    /**
+     * @brief AlphaMode : Façon dont les pixels du sprite sont stockés
+     */
+    enum AlphaMode {
+        ALPHA_STRAIGHT,      /**< Tels que dans le fichier, la transparence a part (par défaut) */
+        ALPHA_PREMULTIPLIED, /**< Rouge, vert et bleu multipliés par la transparence au chargement */
+    };
+
+    /**
+     * @brief Retourne le nombre de composantes des valeurs d'une transition, connu a la compilation
+     * @param[in] id : ID de la transition
+     * @fn static constexpr size_t getComponentCount(const int id);
+     */
+    static constexpr size_t getComponentCount(const int id)
+    {
+        return (id == TRANSITION_POSITION) ? nsTransition::KPositionComponents
+             : nsTransition::KScalarComponents;
+    } // getComponentCount()
+
     /**
      * @brief Constructeur pour la classe Sprite, charge les données depuis un fichier
      * @param[in] filename : Chemin d'accès vers le fichier image
      * @param[in] position : Position du sprite
-     * @fn Sprite(const std::string& filename, const nsGraphics::Vec2D& position = nsGraphics::Vec2D());
+     * @param[in] alphaMode : Mode de stockage des pixels
+     * @fn Sprite(const std::string& filename, const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const AlphaMode& alphaMode = ALPHA_STRAIGHT);
+     *
+     * En ALPHA_PREMULTIPLIED, les pixels sont prémultipliés une fois pour toutes au chargement, et le sprite
+     * s'affiche avec le mode de mélange MinGL::BLEND_PREMULTIPLIED_ALPHA. Un mélange ne coûte alors plus
+     * qu'une multiplication-addition par composante, et les pixels transparents ne laissent plus de liseré
+     * de couleur quand le sprite est redimensionné, filtré ou rangé dans un atlas.
      */
-    Sprite(const std::string& filename, const nsGraphics::Vec2D& position = nsGraphics::Vec2D());
+    Sprite(const std::string& filename, const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const AlphaMode& alphaMode = ALPHA_STRAIGHT);
 
     /**
      * @brief Constructeur pour la classe Sprite, copie les données depuis un vecteur de pixels
      * @param[in] pixelData : Vecteur contenant des données sur les pixels
      * @param[in] rowSize : Nombre de pixels par ligne
      * @param[in] position : Position du sprite
-     * @fn Sprite(const std::vector<nsGraphics::RGBAcolor>& pixelData, const uint32_t& rowSize, const nsGraphics::Vec2D& position = nsGraphics::Vec2D());
+     * @param[in] alphaMode : Mode de stockage des pixels, les pixels donnés étant toujours non prémultipliés
+     * @fn Sprite(const std::vector<nsGraphics::RGBAcolor>& pixelData, const uint32_t& rowSize, const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const AlphaMode& alphaMode = ALPHA_STRAIGHT);
+     */
+    Sprite(const std::vector<nsGraphics::RGBAcolor>& pixelData, const uint32_t& rowSize, const nsGraphics::Vec2D& position = nsGraphics::Vec2D(),
+           const AlphaMode& alphaMode = ALPHA_STRAIGHT);
+
+    /**
+     * @brief Constructeur pour la classe Sprite, crée un sprite indexé depuis une palette et des indices
+     * @param[in] palette : Couleurs de la palette, 256 au plus, non prémultipliées
+     * @param[in] indices : Indice dans la palette de chaque pixel
+     * @param[in] rowSize : Nombre de pixels par ligne
+     * @param[in] position : Position du sprite
+     * @param[in] alphaMode : Mode de stockage de la palette
+     * @fn Sprite(const std::vector<nsGraphics::RGBAcolor>& palette, const std::vector<uint8_t>& indices, const uint32_t& rowSize, const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const AlphaMode& alphaMode = ALPHA_STRAIGHT);
      */
-    Sprite(const std::vector<nsGraphics::RGBAcolor>& pixelData, const uint32_t& rowSize, const nsGraphics::Vec2D& position = nsGraphics::Vec2D());
+    Sprite(const std::vector<nsGraphics::RGBAcolor>& palette, const std::vector<uint8_t>& indices, const uint32_t& rowSize,
+           const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const AlphaMode& alphaMode = ALPHA_STRAIGHT);
+
+    /**
+     * @brief Constructeur pour la classe Sprite, crée une vue sur une zone d'un autre sprite
+     * @param[in] page : Sprite dont les pixels sont affichés, partagé entre toutes ses vues
+     * @param[in] area : Zone de la page a afficher, en pixels depuis son coin haut gauche
+     * @param[in] position : Position du sprite
+     * @fn Sprite(const std::shared_ptr<const Sprite>& page, const nsGraphics::Rect& area, const nsGraphics::Vec2D& position = nsGraphics::Vec2D());
+     *
+     * Aucun pixel n'est copié : la vue garde la page en vie, et en reprend le stockage et le mode de transparence.
+     * Une vue créée sur une autre vue désigne directement la page de celle-ci.
+     * Lance une CException (KErrArg) si la page est nulle, ou si la zone est vide ou sort de la page.
+     */
+    Sprite(const std::shared_ptr<const Sprite>& page, const nsGraphics::Rect& area, const nsGraphics::Vec2D& position = nsGraphics::Vec2D());
+
+    /**
+     * @brief Constructeur pour la classe Sprite, lit un .si2 déjà en mémoire sans copier ses pixels
+     * @param[in] data : Début du contenu du fichier .si2
+     * @param[in] size : Taille du contenu, en octets
+     * @param[in] owner : Propriétaire de la mémoire, gardé en vie par le sprite et ses copies (nul pour une mémoire statique)
+     * @param[in] position : Position du sprite
+     * @param[in] alphaMode : Mode de stockage des pixels
+     * @fn Sprite(const void* data, const size_t& size, const std::shared_ptr<const void>& owner = std::shared_ptr<const void>(), const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const AlphaMode& alphaMode = ALPHA_STRAIGHT);
+     *
+     * Sans propriétaire, le sprite lit directement un tableau statique, tel qu'un .si2 compilé dans l'exécutable.
+     * Seule la palette d'un sprite indexé est copiée. Les pixels RGBA d'un sprite ALPHA_PREMULTIPLIED doivent
+     * être modifiés, et sont donc copiés eux aussi. La mémoire ne doit pas changer tant que le sprite existe.
+     * Lance une CException (KErrArg) si le contenu n'est pas un .si2 valide.
+     */
+    Sprite(const void* data, const size_t& size, const std::shared_ptr<const void>& owner = std::shared_ptr<const void>(),
+           const nsGraphics::Vec2D& position = nsGraphics::Vec2D(), const AlphaMode& alphaMode = ALPHA_STRAIGHT);
 
     virtual void draw(MinGL& window) const override;
 
-    virtual void getValues(const int &id, std::vector<float> &values) override;
-    virtual void setValues(const int &id, const std::vector<float> &values) override;
+    using nsTransition::ITransitionable::getValues;
+    using nsTransition::ITransitionable::setValues;
+    virtual void getValues(const int &id, nsTransition::ValueSpan_t values) override;
+    virtual void setValues(const int &id, nsTransition::ConstValueSpan_t values) override;
+    virtual size_t getValueCount(const int &id) const override;
 
     /**
      * @brief Récupère le nombre de pixels par ligne
@@ -65,11 +148,96 @@ public:
     const uint32_t& getRowSize() const;
 
     /**
-     * @brief Récupère le vecteur contenant les pixels de l'image
-     * @return Une référence constante vers m_pixelData
-     * @fn const std::vector<nsGraphics::RGBAcolor>& getPixelData() const;
+     * @brief Récupère le mode de stockage des pixels
+     * @fn AlphaMode getAlphaMode() const;
+     */
+    AlphaMode getAlphaMode() const;
+
+    /**
+     * @brief Retourne vrai si le sprite est indexé (voir getPalette() et computeIndices())
+     * @fn bool isIndexed() const;
+     */
+    bool isIndexed() const;
+
+    /**
+     * @brief Récupère le nombre de pixels de l'image
+     * @fn size_t getPixelCount() const;
+     */
+    size_t getPixelCount() const;
+
+    /**
+     * @brief Retourne vrai si le sprite est une vue sur une zone d'un autre sprite (voir getPage())
+     * @fn bool isView() const;
+     */
+    bool isView() const;
+
+    /**
+     * @brief Récupère le sprite dont une vue affiche une zone
+     * @return Une référence constante vers m_page, nulle si le sprite a ses propres pixels
+     * @fn const std::shared_ptr<const Sprite>& getPage() const;
+     */
+    const std::shared_ptr<const Sprite>& getPage() const;
+
+    /**
+     * @brief Retourne vrai si le sprite lit ses pixels dans une mémoire qui ne lui appartient pas
+     * @fn bool isInExternalMemory() const;
+     */
+    bool isInExternalMemory() const;
+
+    /**
+     * @brief Récupère la zone affichée, dans la page pour une vue, l'image entière sinon
+     * @fn nsGraphics::Rect getArea() const;
+     */
+    nsGraphics::Rect getArea() const;
+
+    /**
+     * @brief Récupère la palette d'un sprite indexé
+     * @return Une référence constante vers la palette, celle de la page pour une vue, vide si le sprite n'est pas indexé
+     * @fn const std::vector<nsGraphics::RGBAcolor>& getPalette() const;
+     */
+    const std::vector<nsGraphics::RGBAcolor>& getPalette() const;
+
+    /**
+     * @brief Récupère la palette d'un sprite indexé, pour la modifier
+     * @return Une référence vers m_palette
+     * @fn std::vector<nsGraphics::RGBAcolor>& getPalette();
+     *
+     * Modifier une entrée recolore tous les pixels qui l'utilisent, pour le prix d'une seule couleur.
+     * La palette ne doit pas rétrécir, et ses couleurs sont dans le mode de stockage du sprite.
+     * Une vue copie d'abord sa zone de la page, pour ne pas recolorer les autres vues.
+     */
+    std::vector<nsGraphics::RGBAcolor>& getPalette();
+
+    /**
+     * @brief Copie l'indice dans la palette de chaque pixel affiché par un sprite indexé, quel que soit leur stockage
+     * @return Les indices de getArea(), ligne par ligne, vide si le sprite n'est pas indexé
+     * @fn std::vector<uint8_t> computeIndices() const;
+     */
+    std::vector<uint8_t> computeIndices() const;
+
+    /**
+     * @brief Copie les pixels affichés par le sprite, quel que soit leur stockage
+     * @return Les pixels de getArea(), ligne par ligne, dans le mode de stockage du sprite
+     * @fn std::vector<nsGraphics::RGBAcolor> computePixelData() const;
+     *
+     * Les pixels d'un sprite indexé sont décodés a travers sa palette, ceux d'une vue lus dans sa page.
+     * Le sprite n'est pas modifié : c'est la lecture a utiliser sur un sprite constant, getPixelData() ne
+     * l'étant pas.
+     */
+    std::vector<nsGraphics::RGBAcolor> computePixelData() const;
+
+    /**
+     * @brief Récupère le vecteur contenant les pixels de l'image, pour le modifier
+     * @return Une référence vers m_pixelData
+     * @fn std::vector<nsGraphics::RGBAcolor>& getPixelData();
+     *
+     * Les fonctions de color_ops.h permettent d'y appliquer un effet (teinte, fondu...) en une passe.
+     * Le nombre de pixels ne doit pas changer, et les pixels sont dans le mode de stockage du sprite (voir getAlphaMode()).
+     * Une vue ou un sprite en mémoire externe copie d'abord ses pixels, et devient un sprite ordinaire.
+     * Un sprite indexé décode ses indices a travers sa palette et devient un sprite RGBA : sa palette et ses indices
+     * sont vidés, et chaque pixel prend alors 4 octets au lieu d'un.
      */
-    const std::vector<nsGraphics::RGBAcolor>& getPixelData() const;
+    std::vector<nsGraphics::RGBAcolor>& getPixelData();
 
     /**
      * @brief Récupère la position du sprite
@@ -87,12 +255,26 @@ public:
 
     /**
      * @brief Calcule la taille du sprite
-     * @return La taille calculée
+     * @return La taille calculée (largeur, hauteur)
      * @fn Vec2D computeSize() const;
      */
     nsGraphics::Vec2D computeSize() const;
 
+    /**
+     * @brief Calcule le rectangle occupé par le sprite a sa position actuelle
+     * @fn nsGraphics::Rect computeBounds() const;
+     */
+    nsGraphics::Rect computeBounds() const;
+
 private:
+    /**
+     * @brief Versions du format .si2
+     */
+    enum FileVersion : uint16_t {
+        FILE_VERSION_RGBA = 1,    /**< Pixels stockés en RGBA8888 */
+        FILE_VERSION_INDEXED = 2, /**< Palette RGBA8888 puis un indice de palette sur 8 bits par pixel */
+    };
+
     /**
      * @struct FileBegin
      * @brief Décrit le début d'un fichier .si2
@@ -103,9 +285,56 @@ private:
         uint16_t fileVersion; /**< La version du format stockée par le fichier */
         uint32_t pixelCount; /**< Le nombre de pixels contenus dans la section données */
         uint32_t rowSize; /**< Le nombre de pixels par ligne */
-        uint32_t datamagic; /**< Le magic number de la section données, doit toujours être "DATA" */
+        uint32_t datamagic; /**< Le magic number de la section suivante : "DATA" en version 1, "PALT" en version 2 */
     } __attribute__((packed));
 
+    /**
+     * @brief Lit les pixels d'un fichier .si2 ouvert
+     * @param[in] fd : Descripteur du fichier, positionné au début
+     * @return Faux si le fichier est tronqué ou invalide
+     * @fn bool loadFromFile(const int& fd);
+     */
+    bool loadFromFile(const int& fd);
+
+    /**
+     * @brief Lit un .si2 en mémoire, en y laissant les pixels ou les indices
+     * @param[in] data : Début du contenu du fichier
+     * @param[in] size : Taille du contenu, en octets
+     * @return Faux si le contenu est tronqué ou invalide
+     * @fn bool loadFromMemory(const uint8_t* data, const size_t& size);
+     */
+    bool loadFromMemory(const uint8_t* data, const size_t& size);
+
+    /**
+     * @brief Vérifie les champs communs a toutes les versions du début d'un fichier .si2
+     * @fn static bool isFileBeginValid(const FileBegin& fileBegin);
+     */
+    static bool isFileBeginValid(const FileBegin& fileBegin);
+
+    /**
+     * @brief Récupère le premier pixel RGBA, dans m_pixelData ou en mémoire externe
+     * @fn const nsGraphics::RGBAcolor* getPixelPointer() const;
+     */
+    const nsGraphics::RGBAcolor* getPixelPointer() const;
+
+    /**
+     * @brief Récupère le premier indice de palette, dans m_indices ou en mémoire externe
+     * @fn const uint8_t* getIndexPointer() const;
+     */
+    const uint8_t* getIndexPointer() const;
+
+    /**
+     * @brief Vérifie que chaque indice désigne une entrée de la palette
+     * @fn bool areIndicesValid() const;
+     */
+    bool areIndicesValid() const;
+
+    /**
+     * @brief Copie les pixels lus dans la page d'une vue ou en mémoire externe, pour que le sprite ait les siens
+     * @fn void detachStorage();
+     */
+    void detachStorage();
+
     /**
      * @brief m_position : Position de ce Sprite
      */
@@ -120,6 +349,51 @@ private:
      * @brief m_pixelData : Vecteur contenant tout les pixels composant l'image
      */
     std::vector<nsGraphics::RGBAcolor> m_pixelData;
+
+    /**
+     * @brief m_palette : Palette d'un sprite indexé, vide sinon
+     */
+    std::vector<nsGraphics::RGBAcolor> m_palette;
+
+    /**
+     * @brief m_indices : Indice dans m_palette de chaque pixel d'un sprite indexé, vide sinon
+     */
+    std::vector<uint8_t> m_indices;
+
+    /**
+     * @brief m_alphaMode : Mode de stockage de m_pixelData
+     */
+    AlphaMode m_alphaMode;
+
+    /**
+     * @brief m_page : Sprite dont une vue affiche une zone, nul si le sprite a ses propres pixels
+     */
+    std::shared_ptr<const Sprite> m_page;
+
+    /**
+     * @brief m_area : Zone de m_page affichée par une vue
+     */
+    nsGraphics::Rect m_area;
+
+    /**
+     * @brief m_memoryOwner : Garde en vie la mémoire externe lue par le sprite
+     */
+    std::shared_ptr<const void> m_memoryOwner;
+
+    /**
+     * @brief m_memoryPixels : Pixels RGBA en mémoire externe, nul sinon
+     */
+    const nsGraphics::RGBAcolor* m_memoryPixels = nullptr;
+
+    /**
+     * @brief m_memoryIndices : Indices de palette en mémoire externe, nul sinon
+     */
+    const uint8_t* m_memoryIndices = nullptr;
+
+    /**
+     * @brief m_memoryPixelCount : Nombre de pixels en mémoire externe
+     */
+    size_t m_memoryPixelCount = 0;
 }; // class Sprite
 
 } // namespace nsGui
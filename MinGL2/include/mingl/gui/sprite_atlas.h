@@ -0,0 +1,128 @@
+/**
+ *
+ * @file    sprite_atlas.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Page de sprites rangés dans une seule image
+ *
+ **/
+
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "../graphics/rect.h"
+#include "asset_bundle.h"
+#include "sprite.h"
+
+namespace nsGui {
+
+/**
+ * @class SpriteAtlas
+ * @brief Charge une page .si2 et l'index des zones qui y sont rangées, tels que créés par tools/si2atlas.py
+ *
+ * L'index est un fichier texte : une ligne "page <fichier .si2>", chemin relatif au dossier de l'index,
+ * puis une ligne "<nom> <x> <y> <largeur> <hauteur>" par image. Les lignes vides et celles commençant par '#' sont ignorées.
+ *
+ * Chaque sprite servi par l'atlas est une vue sur la page : tous partagent les mêmes pixels, chargés une seule fois.
+ */
+class SpriteAtlas
+{
+public:
+    /**
+     * @brief Constructeur pour la classe SpriteAtlas, charge l'index puis la page qu'il désigne
+     * @param[in] indexFilename : Chemin d'accès vers le fichier index
+     * @param[in] alphaMode : Mode de stockage des pixels de la page
+     * @fn SpriteAtlas(const std::string& indexFilename, const Sprite::AlphaMode& alphaMode = Sprite::ALPHA_STRAIGHT);
+     *
+     * Lance une CException (KFileError) si l'index ou la page ne peut être lu, ou si une zone sort de la page.
+     */
+    SpriteAtlas(const std::string& indexFilename, const Sprite::AlphaMode& alphaMode = Sprite::ALPHA_STRAIGHT);
+
+    /**
+     * @brief Constructeur pour la classe SpriteAtlas, lit l'index et la page dans un paquet
+     * @param[in] bundle : Paquet contenant l'index et la page
+     * @param[in] indexName : Nom de l'index dans le paquet, la page étant cherchée a côté
+     * @param[in] alphaMode : Mode de stockage des pixels de la page
+     * @fn SpriteAtlas(const AssetBundle& bundle, const std::string& indexName, const Sprite::AlphaMode& alphaMode = Sprite::ALPHA_STRAIGHT);
+     *
+     * La page lit ses pixels directement dans le paquet. Lance une CException (KFileError) si l'index n'est pas valide,
+     * ou (KErrArg) si le paquet ne contient pas l'index ou la page.
+     */
+    SpriteAtlas(const AssetBundle& bundle, const std::string& indexName, const Sprite::AlphaMode& alphaMode = Sprite::ALPHA_STRAIGHT);
+
+    /**
+     * @brief Retourne vrai si l'atlas contient une image de ce nom
+     * @param[in] name : Nom de l'image
+     * @fn bool contains(const std::string& name) const;
+     */
+    bool contains(const std::string& name) const;
+
+    /**
+     * @brief Récupère la zone de la page occupée par une image
+     * @param[in] name : Nom de l'image
+     * @fn nsGraphics::Rect getArea(const std::string& name) const;
+     *
+     * Lance une CException (KErrArg) si l'atlas ne contient pas d'image de ce nom.
+     */
+    nsGraphics::Rect getArea(const std::string& name) const;
+
+    /**
+     * @brief Crée un sprite affichant une image de l'atlas, sans copier ses pixels
+     * @param[in] name : Nom de l'image
+     * @param[in] position : Position du sprite
+     * @fn Sprite getSprite(const std::string& name, const nsGraphics::Vec2D& position = nsGraphics::Vec2D()) const;
+     *
+     * Lance une CException (KErrArg) si l'atlas ne contient pas d'image de ce nom.
+     */
+    Sprite getSprite(const std::string& name, const nsGraphics::Vec2D& position = nsGraphics::Vec2D()) const;
+
+    /**
+     * @brief Récupère la page contenant toutes les images
+     * @return Une référence constante vers m_page
+     * @fn const std::shared_ptr<const Sprite>& getPage() const;
+     */
+    const std::shared_ptr<const Sprite>& getPage() const;
+
+    /**
+     * @brief Récupère la zone de chaque image, par nom
+     * @return Une référence constante vers m_areas
+     * @fn const std::map<std::string, nsGraphics::Rect>& getAreas() const;
+     */
+    const std::map<std::string, nsGraphics::Rect>& getAreas() const;
+
+private:
+    /**
+     * @brief Lit les zones de l'index
+     * @param[in] index : Contenu de l'index
+     * @param[in] indexName : Nom de l'index, pour les messages d'erreur et pour situer la page
+     * @return Le chemin de la page, relatif au même dossier que indexName
+     * @fn std::string readIndex(std::istream& index, const std::string& indexName);
+     */
+    std::string readIndex(std::istream& index, const std::string& indexName);
+
+    /**
+     * @brief Vérifie que toutes les zones sont dans la page
+     * @param[in] indexName : Nom de l'index, pour les messages d'erreur
+     * @fn void checkAreas(const std::string& indexName) const;
+     */
+    void checkAreas(const std::string& indexName) const;
+
+    /**
+     * @brief m_page : Image contenant toutes les autres, partagée par les sprites servis
+     */
+    std::shared_ptr<const Sprite> m_page;
+
+    /**
+     * @brief m_areas : Zone de la page occupée par chaque image, par nom
+     */
+    std::map<std::string, nsGraphics::Rect> m_areas;
+}; // class SpriteAtlas
+
+} // namespace nsGui
+
+#endif // SPRITE_ATLAS_H
@@ -39,6 +39,18 @@ public:
         TRANSITION_POSITION, /**< Transition pour la position */
     };
 
+    /**
+     * @brief Retourne le nombre de composantes des valeurs d'une transition, connu a la compilation
+     * @param[in] id : ID de la transition
+     * @fn static constexpr size_t getComponentCount(const int id);
+     */
+    static constexpr size_t getComponentCount(const int id)
+    {
+        return (id == TRANSITION_COLOR_RGB) ? nsTransition::KColorRGBComponents
+             : (id == TRANSITION_POSITION) ? nsTransition::KPositionComponents
+             : nsTransition::KScalarComponents;
+    } // getComponentCount()
+
     /**
      * @brief VerticalAlignment : Liste de tout les alignements verticaux supportés
      */
@@ -77,8 +89,11 @@ public:
 
     virtual void draw(MinGL& window) const override;
 
-    virtual void getValues(const int &id, std::vector<float> &values) override;
-    virtual void setValues(const int &id, const std::vector<float> &values) override;
+    using nsTransition::ITransitionable::getValues;
+    using nsTransition::ITransitionable::setValues;
+    virtual void getValues(const int &id, nsTransition::ValueSpan_t values) override;
+    virtual void setValues(const int &id, nsTransition::ConstValueSpan_t values) override;
+    virtual size_t getValueCount(const int &id) const override;
 
     /**
      * @brief Calcule la largeur de ce texte
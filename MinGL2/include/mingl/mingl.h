@@ -11,6 +11,7 @@
 #ifndef MINGL_H
 #define MINGL_H
 
+#include <chrono>
 #include <map>
 #include <memory> // shared_ptr
 #include <queue>
@@ -54,6 +55,14 @@ public:
      */
     typedef std::map<KeyType_t, bool> KeyMap_t;
 
+    /**
+     * @brief BlendMode : Façon dont les couleurs affichées sont mélangées avec le fond
+     */
+    enum BlendMode {
+        BLEND_STRAIGHT_ALPHA,      /**< Couleurs non prémultipliées : GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA (par défaut) */
+        BLEND_PREMULTIPLIED_ALPHA, /**< Couleurs déjà multipliées par leur transparence : GL_ONE, GL_ONE_MINUS_SRC_ALPHA */
+    };
+
     /**
      * @brief Constructeur pour la classe MinGL
      * @param[in] name : Nom de la fenêtre
@@ -122,6 +131,26 @@ public:
      */
     void clearScreen();
 
+    /**
+     * @brief Attend une saisie de l'utilisateur, sans afficher de nouvelle frame
+     * @details A utiliser a la place de finishFrame() quand rien n'a changé a l'écran :
+     *          l'image précédente reste affichée et le processeur est laissé au repos.
+     *          Sous X11, le thread dort dans poll() sur la connexion au serveur jusqu'au prochain évènement.
+     *          Ailleurs, freeglut n'offrant pas d'attente bloquante, les évènements sont relevés toutes les 10 ms.
+     * @param[in] timeout : Durée maximale d'attente
+     * @return Vrai si une saisie (ou une demande de réaffichage) est arrivée avant la fin du délai
+     * @fn bool waitEvents(const std::chrono::milliseconds& timeout);
+     */
+    bool waitEvents(const std::chrono::milliseconds& timeout);
+
+    /**
+     * @brief Indique si le contenu de la fenêtre doit être redessiné
+     * @details C'est le cas après un redimensionnement, ou quand le système demande un réaffichage
+     *          alors qu'aucune frame n'était prête. Remis a faux par finishFrame().
+     * @fn bool needsRedraw() const;
+     */
+    bool needsRedraw() const;
+
     /**
      * @brief Récupère le gestionnaire d'évènements minGL
      * @fn nsEvent::EventManager& getEventManager();
@@ -140,8 +169,25 @@ public:
      */
     void setBackgroundColor(const nsGraphics::RGBAcolor& backgroundColor);
 
+    /**
+     * @brief Récupère le mode de mélange actuel
+     * @fn BlendMode getBlendMode() const;
+     */
+    BlendMode getBlendMode() const;
+
+    /**
+     * @brief Règle le mode de mélange
+     * @param[in] blendMode : Nouveau mode
+     * @fn void setBlendMode(const BlendMode& blendMode);
+     *
+     * Le mode est mis en cache : OpenGL n'est appelé que s'il change. Un élément qui change de mode
+     * doit remettre BLEND_STRAIGHT_ALPHA après s'être affiché, les autres éléments comptant dessus.
+     */
+    void setBlendMode(const BlendMode& blendMode);
+
     /**
      * @brief Récupère la taille de la fenêtre
+     * @details La taille est mise en cache et rafraîchie par callReshape(), sans interroger freeglut
      * @fn nsGraphics::Vec2D getWindowSize() const;
      */
     nsGraphics::Vec2D getWindowSize() const;
@@ -155,6 +201,7 @@ public:
 
     /**
      * @brief Récupère la position de la fenêtre
+     * @details La position est mise en cache et rafraîchie par callPosition(), sans interroger freeglut
      * @fn nsGraphics::Vec2D getWindowPosition() const;
      */
     nsGraphics::Vec2D getWindowPosition() const;
@@ -198,6 +245,21 @@ private:
      */
     nsGraphics::RGBAcolor m_bgColor;
 
+    /**
+     * @brief m_blendMode : Mode de mélange actuellement réglé dans OpenGL
+     */
+    BlendMode m_blendMode = BLEND_STRAIGHT_ALPHA;
+
+    /**
+     * @brief m_windowSize : Taille de la fenêtre, mise a jour par callReshape()
+     */
+    nsGraphics::Vec2D m_windowSize;
+
+    /**
+     * @brief m_windowPosition : Position de la fenêtre, mise a jour par callPosition()
+     */
+    nsGraphics::Vec2D m_windowPosition;
+
     /**
      * @brief m_keyboardMap : Map de l'état des touches du clavier
      */
@@ -218,15 +280,38 @@ private:
      */
     bool m_windowIsOpen;
 
+    /**
+     * @brief m_frameReady : Vrai entre finishFrame() et l'échange des buffers dans callDisplay()
+     */
+    bool m_frameReady = false;
+
+    /**
+     * @brief m_redrawRequested : Vrai si le contenu de la fenêtre doit être redessiné
+     */
+    bool m_redrawRequested = true;
+
+    /**
+     * @brief m_activityCount : Compteur incrémenté a chaque saisie ou demande de réaffichage, utilisé par waitEvents()
+     */
+    unsigned long long m_activityCount = 0;
+
     // Les handlers
 
     /**
      * @brief Handler lié a <a href="https://www.opengl.org/resources/libraries/glut/spec3/node48.html">glutReshapeFunc</a>
-     * @param[in] h : Nouvelle hauteur de la fenêtre
-     * @param[in] w : Nouvelle largeur de la fenêtre
-     * @fn void callReshape(int h, int w);
+     * @param[in] width : Nouvelle largeur de la fenêtre
+     * @param[in] height : Nouvelle hauteur de la fenêtre
+     * @fn void callReshape(int width, int height);
+     */
+    void callReshape(int width, int height);
+
+    /**
+     * @brief Handler lié a <a href="http://freeglut.sourceforge.net/docs/api.php#WindowCallback">glutPositionFunc</a>
+     * @param[in] x : Nouvelle coordonnée X de la fenêtre
+     * @param[in] y : Nouvelle coordonnée Y de la fenêtre
+     * @fn void callPosition(int x, int y);
      */
-    void callReshape(int h, int w);
+    void callPosition(int x, int y);
 
     /**
      * @brief Handler lié a <a href="https://www.opengl.org/resources/libraries/glut/spec3/node46.html">glutDisplayFunc</a>
@@ -38,6 +38,18 @@ public:
         TRANSITION_SECOND_POSITION, /**< Transition pour la position du coin bas-droit */
     };
 
+    /**
+     * @brief Retourne le nombre de composantes des valeurs d'une transition, connu a la compilation
+     * @param[in] id : ID de la transition
+     * @fn static constexpr size_t getComponentCount(const int id);
+     */
+    static constexpr size_t getComponentCount(const int id)
+    {
+        return (id == TRANSITION_FILL_COLOR_RGB || id == TRANSITION_BORDER_COLOR_RGB) ? nsTransition::KColorRGBComponents
+             : (id == TRANSITION_FIRST_POSITION || id == TRANSITION_SECOND_POSITION) ? nsTransition::KPositionComponents
+             : nsTransition::KScalarComponents;
+    } // getComponentCount()
+
     /**
      * @brief Constructeur pour la classe Rectangle
      * @param[in] firstPosition : Position du coin haut-gauche
@@ -71,8 +83,11 @@ public:
 
     virtual void draw(MinGL& window) const override;
 
-    virtual void getValues(const int &id, std::vector<float> &values) override;
-    virtual void setValues(const int &id, const std::vector<float> &values) override;
+    using nsTransition::ITransitionable::getValues;
+    using nsTransition::ITransitionable::setValues;
+    virtual void getValues(const int &id, nsTransition::ValueSpan_t values) override;
+    virtual void setValues(const int &id, nsTransition::ConstValueSpan_t values) override;
+    virtual size_t getValueCount(const int &id) const override;
 
     /**
      * @brief Opérateur de décalage
@@ -11,14 +11,20 @@
 #ifndef ITRANSITIONABLE_H
 #define ITRANSITIONABLE_H
 
+#include <algorithm>
 #include <vector>
 
+#include "transition_types.h"
+
 namespace nsTransition
 {
 
 /**
  * @class ITransitionable
  * @brief Une classe abstraite pour n'importe quelle élément pouvant effectuer une transition entre deux états
+ *
+ * Une classe dérivée redéfinit getValues() et setValues(), soit dans leur version prenant une vue, soit dans celle
+ * prenant un vecteur : chaque version appelle l'autre par défaut.
  */
 class ITransitionable
 {
@@ -29,21 +35,72 @@ public:
      */
     virtual ~ITransitionable() {}
 
+    /**
+     * @brief Récupère des valeurs pour l'ID spécifié
+     * @param[in] id: ID des valeurs a récupérer
+     * @param[in, out] values: Vue sur les valeurs a peupler, de la taille attendue pour cet ID
+     * @fn virtual void getValues(const int& id, ValueSpan_t values);
+     *
+     * Adaptateur vers la version prenant un vecteur par défaut, pour les classes qui ne redéfinissent que celle-ci.
+     */
+    virtual void getValues(const int& id, ValueSpan_t values)
+    {
+        std::vector<float> vector(values.begin(), values.end());
+        getValues(id, vector);
+        std::copy_n(vector.begin(), std::min(vector.size(), values.size()), values.begin());
+    } // getValues()
+
+    /**
+     * @brief Définit les nouvelles valeurs pour l'ID spécifié
+     * @param[in] id: ID des valeurs a définir
+     * @param[in] values: Vue sur les nouvelles valeurs a appliquer
+     * @fn virtual void setValues(const int& id, ConstValueSpan_t values);
+     *
+     * Adaptateur vers la version prenant un vecteur par défaut, pour les classes qui ne redéfinissent que celle-ci.
+     */
+    virtual void setValues(const int& id, ConstValueSpan_t values)
+    {
+        setValues(id, std::vector<float>(values.begin(), values.end()));
+    } // setValues()
+
     /**
      * @brief Récupère des valeurs dans un vecteur de float pour l'ID spécifié
      * @param[in] id: ID des valeurs a récupérer
      * @param[in, out] values: Vecteur de valeurs a peupler
      * @fn virtual void getValues(const int& id, std::vector<float>& values);
+     *
+     * Adaptateur vers la version prenant une vue, conservé pour le code existant.
      */
-    virtual void getValues(const int& id, std::vector<float>& values) = 0;
+    virtual void getValues(const int& id, std::vector<float>& values)
+    {
+        getValues(id, ValueSpan_t(values));
+    } // getValues()
 
     /**
      * @brief Définit les nouvelles valeurs pour l'ID spécifié
      * @param[in] id: ID des valeurs a définir
      * @param[in] values: Vecteur des nouvelles valeurs a appliquer
      * @fn virtual void setValues(const int& id, const std::vector<float>& values);
+     *
+     * Adaptateur vers la version prenant une vue, conservé pour le code existant.
+     */
+    virtual void setValues(const int& id, const std::vector<float>& values)
+    {
+        setValues(id, ConstValueSpan_t(values));
+    } // setValues()
+
+    /**
+     * @brief Récupère le nombre de valeurs de l'ID spécifié
+     * @param[in] id: ID des valeurs
+     * @return Le nombre de valeurs attendu, ou 0 s'il n'est pas connu (valeur par défaut)
+     * @fn virtual size_t getValueCount(const int& id) const;
+     *
+     * TransitionContract refuse une destination qui n'a pas ce nombre de valeurs.
      */
-    virtual void setValues(const int& id, const std::vector<float>& values) = 0;
+    virtual size_t getValueCount(const int& /*id*/) const
+    {
+        return 0;
+    } // getValueCount()
 }; // class ITransitionable
 
 } // namespace nsTransition
@@ -58,6 +58,15 @@ public:
      */
     void setElapsed(const SystemDuration_t& elapsed);
 
+    /**
+     * @brief Définit un nouveau temps écoulé pour cette Transition, en utilisant un temps actuel déjà lu,
+     * puis met a jour les valeurs de la cible
+     * @param[in] elapsed : Nouveau temps écoulé
+     * @param[in] now : Temps actuel
+     * @fn void setElapsed(const SystemDuration_t& elapsed, const SystemTimePoint_t& now);
+     */
+    void setElapsed(const SystemDuration_t& elapsed, const SystemTimePoint_t& now);
+
     /**
      * @brief Rajoute une durée au temps écoulé actuel
      * @param[in] addedTime : Durée a rajouter
@@ -65,6 +74,14 @@ public:
      */
     void addToElapsed(const SystemDuration_t& addedTime);
 
+    /**
+     * @brief Rajoute une durée au temps écoulé actuel, en utilisant un temps actuel déjà lu
+     * @param[in] addedTime : Durée a rajouter
+     * @param[in] now : Temps actuel
+     * @fn void addToElapsed(const SystemDuration_t& addedTime, const SystemTimePoint_t& now);
+     */
+    void addToElapsed(const SystemDuration_t& addedTime, const SystemTimePoint_t& now);
+
     /**
      * @brief Indique si cette Transition est en train de se jouer a l'envers
      * @return Une référence const vers m_reverse
@@ -112,17 +129,21 @@ private:
     /**
      * @brief Calcule et définit les nouvelles valeurs a la cible,
      * basé sur le temps écoulé, la durée de la transition et le temps de départ
-     * @fn void updateValues();
+     * @param[in] now : Temps actuel
+     * @fn void updateValues(const SystemTimePoint_t& now);
      */
-    void updateValues();
+    void updateValues(const SystemTimePoint_t& now);
 
     /**
      * @brief Appelé quand cette Transition s'est terminée
-     * @fn void handleEndlife();
+     * @param[in] now : Temps actuel
+     * @fn void handleEndlife(const SystemTimePoint_t& now);
      */
-    void handleEndlife();
+    void handleEndlife(const SystemTimePoint_t& now);
 }; // class Transition
 
 } // namespace nsTransition
 
+#include "transition.hpp"
+
 #endif // TRANSITION_H
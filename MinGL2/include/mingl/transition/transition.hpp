@@ -0,0 +1,30 @@
+/**
+ *
+ * @file    transition.hpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Fonctions de Transition définies en ligne, car appelées pour chaque transition a chaque mise a jour
+ *
+ **/
+
+#ifndef TRANSITION_HPP
+#define TRANSITION_HPP
+
+#include "transition.h"
+
+inline const nsTransition::SystemDuration_t& nsTransition::Transition::getElapsed() const
+{
+    return m_elapsed;
+} // getElapsed()
+
+inline const bool &nsTransition::Transition::isReversed() const
+{
+    return m_reverse;
+} // isReversed()
+
+inline const bool& nsTransition::Transition::isFinished() const
+{
+    return m_finished;
+} // isFinished()
+
+#endif // TRANSITION_HPP
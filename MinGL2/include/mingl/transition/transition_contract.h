@@ -12,9 +12,11 @@
 #define TRANSITION_CONTRACT_H
 
 #include <functional>
+#include <initializer_list>
 #include <vector>
 
 #include "itransitionable.h"
+#include "transition_easing.h"
 #include "transition_types.h"
 
 namespace nsTransition
@@ -49,12 +51,38 @@ public:
                        const SystemDuration_t& duration, const std::vector<float>& destination,
                        const SystemDuration_t& delay = std::chrono::seconds::zero(),
                        const TransitionMode& transitionMode = TransitionMode::MODE_FINITE);
+     * @throws CException (KErrArg) si destination contient plus de TransitionValues::KMaxValues valeurs,
+     *         ou pas le nombre de valeurs que la cible attend pour cet ID (voir ITransitionable::getValueCount())
      */
     TransitionContract(ITransitionable& target, const int& id,
                        const SystemDuration_t& duration, const std::vector<float>& destination,
                        const SystemDuration_t& delay = std::chrono::seconds::zero(),
                        const TransitionMode& transitionMode = TransitionMode::MODE_FINITE);
 
+    /**
+     * @brief Constructeur pour la classe TransitionContract, les valeurs d'arrivée sont passées par une vue
+     * @fn TransitionContract(ITransitionable& target, const int& id,
+                       const SystemDuration_t& duration, ConstValueSpan_t destination,
+                       const SystemDuration_t& delay = std::chrono::seconds::zero(),
+                       const TransitionMode& transitionMode = TransitionMode::MODE_FINITE);
+     */
+    TransitionContract(ITransitionable& target, const int& id,
+                       const SystemDuration_t& duration, ConstValueSpan_t destination,
+                       const SystemDuration_t& delay = std::chrono::seconds::zero(),
+                       const TransitionMode& transitionMode = TransitionMode::MODE_FINITE);
+
+    /**
+     * @brief Constructeur pour la classe TransitionContract, les valeurs d'arrivée sont passées par une liste
+     * @fn TransitionContract(ITransitionable& target, const int& id,
+                       const SystemDuration_t& duration, std::initializer_list<float> destination,
+                       const SystemDuration_t& delay = std::chrono::seconds::zero(),
+                       const TransitionMode& transitionMode = TransitionMode::MODE_FINITE);
+     */
+    TransitionContract(ITransitionable& target, const int& id,
+                       const SystemDuration_t& duration, std::initializer_list<float> destination,
+                       const SystemDuration_t& delay = std::chrono::seconds::zero(),
+                       const TransitionMode& transitionMode = TransitionMode::MODE_FINITE);
+
     /**
      * @brief Retourne l'ID de transition, utilisé par la cible pour connaitre les valeurs a utiliser
      * @return Une référence const vers m_id
@@ -64,7 +92,7 @@ public:
 
     /**
      * @brief Retourne la cible de transition
-     * @return Une référence const vers m_target
+     * @return Une référence const vers la cible pointée par m_target
      * @fn const ITransitionable& getTarget() const;
      */
     const ITransitionable& getTarget() const;
@@ -79,16 +107,16 @@ public:
     /**
      * @brief Retourne les valeurs de départ
      * @return Une référence const vers m_beginning
-     * @fn const std::vector<float>& getBeginning() const;
+     * @fn const TransitionValues& getBeginning() const;
      */
-    const std::vector<float>& getBeginning() const;
+    const TransitionValues& getBeginning() const;
 
     /**
      * @brief Retourne les valeurs d'arrivée
      * @return Une référence const vers m_destination
-     * @fn const std::vector<float>& getDestination() const;
+     * @fn const TransitionValues& getDestination() const;
      */
-    const std::vector<float>& getDestination() const;
+    const TransitionValues& getDestination() const;
 
     /**
      * @brief Retourne la durée de la transition
@@ -104,6 +132,34 @@ public:
      */
     void setDestinationCallback(const std::function<void()>& callback);
 
+    /**
+     * @brief Définit la courbe d'accélération de la transition (linéaire par défaut)
+     * @param[in] easing : Courbe a utiliser
+     * @fn void setEasing(const Easing& easing);
+     */
+    void setEasing(const Easing& easing);
+
+    /**
+     * @brief Utilise une courbe de Bézier cubique personnalisée comme courbe d'accélération
+     * @param[in] cubicBezier : Courbe a utiliser
+     * @fn void setCubicBezier(const CubicBezier& cubicBezier);
+     */
+    void setCubicBezier(const CubicBezier& cubicBezier);
+
+    /**
+     * @brief Retourne la courbe d'accélération de la transition
+     * @return Une référence const vers m_easing
+     * @fn const Easing& getEasing() const;
+     */
+    const Easing& getEasing() const;
+
+    /**
+     * @brief Retourne la courbe de Bézier utilisée quand la courbe d'accélération vaut EASING_CUBIC_BEZIER
+     * @return Une référence const vers m_cubicBezier
+     * @fn const CubicBezier& getCubicBezier() const;
+     */
+    const CubicBezier& getCubicBezier() const;
+
 protected:
     /**
      * @brief m_id : L'ID de la transition
@@ -111,31 +167,32 @@ protected:
      * Ceci est seulement utile pour la cible, car lui seul sait a quel ID correspond quelles valeurs.
      * Ainsi, l'ID n'est jamais utilisée directement par la transition et est seulement passée a la cible.
      */
-    const int m_id;
+    int m_id;
 
     /**
-     * @brief m_target : Une référence vers une instance d'une classe dérivée d'ITransitionable
+     * @brief m_target : Un pointeur (jamais nul) vers une instance d'une classe dérivée d'ITransitionable
      *
      * C'est la cible de la transition, sur laquelle vont s'appliquer les modifications de valeurs.
+     * Un pointeur plutôt qu'une référence, pour que les transitions puissent être déplacées dans un vecteur.
      */
-    ITransitionable& m_target;
+    ITransitionable* m_target;
 
     /**
      * @brief m_transitionMode : Le mode de transition
      *
      * Pour plus d'informations, voyez les valeurs de l'énumération TransitionMode.
      */
-    const TransitionMode m_transitionMode;
+    TransitionMode m_transitionMode;
 
     /**
      * @brief m_beginning : Contient les valeurs de départ
      */
-    std::vector<float> m_beginning;
+    TransitionValues m_beginning;
 
     /**
      * @brief m_destination : Contient les valeurs d'arrivées
      */
-    const std::vector<float> m_destination;
+    TransitionValues m_destination;
 
     /**
      * @brief m_duration : La durée de la transition
@@ -148,11 +205,23 @@ protected:
     SystemDuration_t m_delay;
 
     /**
-     * @brief m_duration : Un pointeur vers la fonction a appeler une fois la transition achevée
+     * @brief m_destinationCallback : La fonction a appeler une fois la transition achevée
      */
     std::function<void()> m_destinationCallback;
+
+    /**
+     * @brief m_easing : La courbe d'accélération de la transition
+     */
+    Easing m_easing;
+
+    /**
+     * @brief m_cubicBezier : La courbe personnalisée, utilisée si m_easing vaut EASING_CUBIC_BEZIER
+     */
+    CubicBezier m_cubicBezier;
 }; // class TransitionContract
 
 } // namespace nsTransition
 
+#include "transition_contract.hpp"
+
 #endif // TRANSITION_CONTRACT_H
@@ -0,0 +1,45 @@
+/**
+ *
+ * @file    transition_contract.hpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Accesseurs de TransitionContract, définis en ligne car utilisés pour chaque transition a chaque mise a jour
+ *
+ **/
+
+#ifndef TRANSITION_CONTRACT_HPP
+#define TRANSITION_CONTRACT_HPP
+
+#include "transition_contract.h"
+
+inline const int& nsTransition::TransitionContract::getId() const
+{
+    return m_id;
+} // getId()
+
+inline const nsTransition::TransitionValues& nsTransition::TransitionContract::getBeginning() const
+{
+    return m_beginning;
+} // getBeginning()
+
+inline const nsTransition::TransitionValues& nsTransition::TransitionContract::getDestination() const
+{
+    return m_destination;
+} // getDestination()
+
+inline const nsTransition::Easing& nsTransition::TransitionContract::getEasing() const
+{
+    return m_easing;
+} // getEasing()
+
+inline const nsTransition::CubicBezier& nsTransition::TransitionContract::getCubicBezier() const
+{
+    return m_cubicBezier;
+} // getCubicBezier()
+
+inline const nsTransition::ITransitionable& nsTransition::TransitionContract::getTarget() const
+{
+    return *m_target;
+} // getTarget()
+
+#endif // TRANSITION_CONTRACT_HPP
@@ -0,0 +1,240 @@
+/**
+ *
+ * @file    transition_easing.h
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Courbes d'accélération (easing) des transitions
+ *
+ **/
+
+#ifndef TRANSITION_EASING_H
+#define TRANSITION_EASING_H
+
+#include <cmath>
+
+namespace nsTransition
+{
+
+/**
+ * @brief Easing : Liste de toutes les courbes d'accélération disponibles
+ *
+ * Les variantes IN accélèrent depuis le départ, les variantes OUT ralentissent vers l'arrivée,
+ * et les variantes IN_OUT font les deux.
+ */
+enum Easing {
+    EASING_LINEAR, /**< Progression constante */
+    EASING_QUAD_IN, /**< Courbe quadratique, accélération */
+    EASING_QUAD_OUT, /**< Courbe quadratique, décélération */
+    EASING_QUAD_IN_OUT, /**< Courbe quadratique, accélération puis décélération */
+    EASING_CUBIC_IN, /**< Courbe cubique, accélération */
+    EASING_CUBIC_OUT, /**< Courbe cubique, décélération */
+    EASING_CUBIC_IN_OUT, /**< Courbe cubique, accélération puis décélération */
+    EASING_BACK_IN, /**< Recule légèrement avant de partir */
+    EASING_BACK_OUT, /**< Dépasse légèrement l'arrivée avant d'y revenir */
+    EASING_BACK_IN_OUT, /**< Recule au départ et dépasse a l'arrivée */
+    EASING_ELASTIC_IN, /**< Oscille de plus en plus fort au départ */
+    EASING_ELASTIC_OUT, /**< Oscille autour de l'arrivée en s'amortissant */
+    EASING_ELASTIC_IN_OUT, /**< Oscille au départ et a l'arrivée */
+    EASING_BOUNCE_IN, /**< Rebondit au départ */
+    EASING_BOUNCE_OUT, /**< Rebondit a l'arrivée */
+    EASING_BOUNCE_IN_OUT, /**< Rebondit au départ et a l'arrivée */
+    EASING_CUBIC_BEZIER, /**< Courbe de Bézier cubique personnalisée (voir CubicBezier) */
+    EASING_COUNT, /**< Nombre de courbes, ne pas utiliser comme courbe */
+};
+
+/**
+ * @namespace nsEasing
+ * @brief Fonctions des courbes standards, définies dans l'en-tête pour être intégrées dans la boucle d'interpolation
+ *
+ * Chaque fonction prend une progression entre 0 et 1 et renvoie la progression modifiée,
+ * qui vaut 0 en 0 et 1 en 1 mais peut sortir de [0, 1] entre les deux (back, elastic).
+ */
+namespace nsEasing
+{
+
+constexpr float KBackOvershoot = 1.70158f;
+constexpr float KBackInOutOvershoot = KBackOvershoot * 1.525f;
+constexpr float KPi = 3.14159265358979f;
+
+constexpr float quadIn(const float t) { return t * t; }
+constexpr float quadOut(const float t) { return t * (2.f - t); }
+constexpr float quadInOut(const float t) { return t < 0.5f ? 2.f * t * t : -1.f + (4.f - 2.f * t) * t; }
+
+constexpr float cubicIn(const float t) { return t * t * t; }
+constexpr float cubicOut(const float t) { return (t - 1.f) * (t - 1.f) * (t - 1.f) + 1.f; }
+constexpr float cubicInOut(const float t) { return t < 0.5f ? 4.f * t * t * t : (t - 1.f) * (2.f * t - 2.f) * (2.f * t - 2.f) + 1.f; }
+
+constexpr float backIn(const float t) { return t * t * ((KBackOvershoot + 1.f) * t - KBackOvershoot); }
+constexpr float backOut(const float t) { return 1.f - backIn(1.f - t); }
+constexpr float backInOut(const float t)
+{
+    return t < 0.5f ? (2.f * t) * (2.f * t) * ((KBackInOutOvershoot + 1.f) * 2.f * t - KBackInOutOvershoot) / 2.f
+                    : ((2.f * t - 2.f) * (2.f * t - 2.f) * ((KBackInOutOvershoot + 1.f) * (2.f * t - 2.f) + KBackInOutOvershoot) + 2.f) / 2.f;
+}
+
+inline float elasticOut(const float t)
+{
+    if (t <= 0.f || t >= 1.f) return t <= 0.f ? 0.f : 1.f;
+    return std::exp2(-10.f * t) * std::sin((t * 10.f - 0.75f) * (2.f * KPi / 3.f)) + 1.f;
+}
+inline float elasticIn(const float t) { return 1.f - elasticOut(1.f - t); }
+inline float elasticInOut(const float t) { return t < 0.5f ? elasticIn(2.f * t) / 2.f : (elasticOut(2.f * t - 1.f) + 1.f) / 2.f; }
+
+constexpr float bounceOut(const float t)
+{
+    return t < 1.f / 2.75f ? 7.5625f * t * t
+         : t < 2.f / 2.75f ? 7.5625f * (t - 1.5f / 2.75f) * (t - 1.5f / 2.75f) + 0.75f
+         : t < 2.5f / 2.75f ? 7.5625f * (t - 2.25f / 2.75f) * (t - 2.25f / 2.75f) + 0.9375f
+         : 7.5625f * (t - 2.625f / 2.75f) * (t - 2.625f / 2.75f) + 0.984375f;
+}
+constexpr float bounceIn(const float t) { return 1.f - bounceOut(1.f - t); }
+constexpr float bounceInOut(const float t) { return t < 0.5f ? bounceIn(2.f * t) / 2.f : (bounceOut(2.f * t - 1.f) + 1.f) / 2.f; }
+
+} // namespace nsEasing
+
+/**
+ * @class EasingCurve
+ * @brief Associe une courbe standard a sa fonction a la compilation
+ * @tparam E : Courbe d'accélération
+ *
+ * Permet d'écrire des boucles spécialisées par courbe, sans appel virtuel ni std::function.
+ */
+template <Easing E>
+struct EasingCurve;
+
+#define MINGL_EASING_CURVE(easing, function) \
+    template <> struct EasingCurve<easing> { static inline float apply(const float t) { return function(t); } }
+
+MINGL_EASING_CURVE(EASING_LINEAR, );
+MINGL_EASING_CURVE(EASING_QUAD_IN, nsEasing::quadIn);
+MINGL_EASING_CURVE(EASING_QUAD_OUT, nsEasing::quadOut);
+MINGL_EASING_CURVE(EASING_QUAD_IN_OUT, nsEasing::quadInOut);
+MINGL_EASING_CURVE(EASING_CUBIC_IN, nsEasing::cubicIn);
+MINGL_EASING_CURVE(EASING_CUBIC_OUT, nsEasing::cubicOut);
+MINGL_EASING_CURVE(EASING_CUBIC_IN_OUT, nsEasing::cubicInOut);
+MINGL_EASING_CURVE(EASING_BACK_IN, nsEasing::backIn);
+MINGL_EASING_CURVE(EASING_BACK_OUT, nsEasing::backOut);
+MINGL_EASING_CURVE(EASING_BACK_IN_OUT, nsEasing::backInOut);
+MINGL_EASING_CURVE(EASING_ELASTIC_IN, nsEasing::elasticIn);
+MINGL_EASING_CURVE(EASING_ELASTIC_OUT, nsEasing::elasticOut);
+MINGL_EASING_CURVE(EASING_ELASTIC_IN_OUT, nsEasing::elasticInOut);
+MINGL_EASING_CURVE(EASING_BOUNCE_IN, nsEasing::bounceIn);
+MINGL_EASING_CURVE(EASING_BOUNCE_OUT, nsEasing::bounceOut);
+MINGL_EASING_CURVE(EASING_BOUNCE_IN_OUT, nsEasing::bounceInOut);
+
+#undef MINGL_EASING_CURVE
+
+/**
+ * @class CubicBezier
+ * @brief Courbe d'accélération personnalisée, définie comme en CSS par ses deux points de contrôle
+ *
+ * La courbe part de (0, 0) et arrive en (1, 1). X est le temps, Y la progression.
+ */
+class CubicBezier
+{
+public:
+    /**
+     * @brief Constructeur pour la classe CubicBezier
+     * @param[in] x1 : Abscisse du premier point de contrôle (entre 0 et 1)
+     * @param[in] y1 : Ordonnée du premier point de contrôle
+     * @param[in] x2 : Abscisse du second point de contrôle (entre 0 et 1)
+     * @param[in] y2 : Ordonnée du second point de contrôle
+     * @fn CubicBezier(const float& x1 = 0.f, const float& y1 = 0.f, const float& x2 = 1.f, const float& y2 = 1.f);
+     */
+    CubicBezier(const float& x1 = 0.f, const float& y1 = 0.f, const float& x2 = 1.f, const float& y2 = 1.f)
+        : m_ax(1.f + 3.f * x1 - 3.f * x2)
+        , m_bx(3.f * x2 - 6.f * x1)
+        , m_cx(3.f * x1)
+        , m_ay(1.f + 3.f * y1 - 3.f * y2)
+        , m_by(3.f * y2 - 6.f * y1)
+        , m_cy(3.f * y1)
+    {} // CubicBezier()
+
+    /**
+     * @brief Calcule la progression modifiée pour une progression donnée
+     * @param[in] t : Progression entre 0 et 1
+     * @fn float apply(const float t) const;
+     */
+    float apply(const float t) const
+    {
+        return sampleY(solveX(t));
+    } // apply()
+
+private:
+    float sampleX(const float u) const { return ((m_ax * u + m_bx) * u + m_cx) * u; }
+    float sampleY(const float u) const { return ((m_ay * u + m_by) * u + m_cy) * u; }
+    float sampleDerivativeX(const float u) const { return (3.f * m_ax * u + 2.f * m_bx) * u + m_cx; }
+
+    /**
+     * @brief Trouve le paramètre u de la courbe dont l'abscisse vaut x
+     * @details Quelques itérations de Newton, puis une dichotomie si la dérivée est trop plate.
+     */
+    float solveX(const float x) const
+    {
+        float u = x;
+        for (int i = 0; i < 4; ++i)
+        {
+            const float error = sampleX(u) - x;
+            if (std::fabs(error) < 1e-5f) return u;
+
+            const float derivative = sampleDerivativeX(u);
+            if (std::fabs(derivative) < 1e-6f) break;
+
+            u -= error / derivative;
+        }
+
+        float low = 0.f, high = 1.f;
+        u = x;
+        for (int i = 0; i < 16; ++i)
+        {
+            const float current = sampleX(u);
+            if (std::fabs(current - x) < 1e-5f) break;
+
+            if (current < x) low = u;
+            else high = u;
+
+            u = (low + high) / 2.f;
+        }
+
+        return u;
+    } // solveX()
+
+    /**
+     * @brief Coefficients des polynômes en X et en Y
+     */
+    float m_ax, m_bx, m_cx;
+    float m_ay, m_by, m_cy;
+}; // class CubicBezier
+
+/**
+ * @brief Applique une courbe standard, choisie a l'exécution, a une progression
+ * @param[in] easing : Courbe a appliquer (EASING_CUBIC_BEZIER est traité comme EASING_LINEAR, voir CubicBezier)
+ * @param[in] t : Progression entre 0 et 1
+ * @fn inline float ease(const Easing& easing, const float t);
+ */
+inline float ease(const Easing& easing, const float t)
+{
+    switch (easing)
+    {
+        case EASING_QUAD_IN: return EasingCurve<EASING_QUAD_IN>::apply(t);
+        case EASING_QUAD_OUT: return EasingCurve<EASING_QUAD_OUT>::apply(t);
+        case EASING_QUAD_IN_OUT: return EasingCurve<EASING_QUAD_IN_OUT>::apply(t);
+        case EASING_CUBIC_IN: return EasingCurve<EASING_CUBIC_IN>::apply(t);
+        case EASING_CUBIC_OUT: return EasingCurve<EASING_CUBIC_OUT>::apply(t);
+        case EASING_CUBIC_IN_OUT: return EasingCurve<EASING_CUBIC_IN_OUT>::apply(t);
+        case EASING_BACK_IN: return EasingCurve<EASING_BACK_IN>::apply(t);
+        case EASING_BACK_OUT: return EasingCurve<EASING_BACK_OUT>::apply(t);
+        case EASING_BACK_IN_OUT: return EasingCurve<EASING_BACK_IN_OUT>::apply(t);
+        case EASING_ELASTIC_IN: return EasingCurve<EASING_ELASTIC_IN>::apply(t);
+        case EASING_ELASTIC_OUT: return EasingCurve<EASING_ELASTIC_OUT>::apply(t);
+        case EASING_ELASTIC_IN_OUT: return EasingCurve<EASING_ELASTIC_IN_OUT>::apply(t);
+        case EASING_BOUNCE_IN: return EasingCurve<EASING_BOUNCE_IN>::apply(t);
+        case EASING_BOUNCE_OUT: return EasingCurve<EASING_BOUNCE_OUT>::apply(t);
+        case EASING_BOUNCE_IN_OUT: return EasingCurve<EASING_BOUNCE_IN_OUT>::apply(t);
+        default: return t;
+    }
+} // ease()
+
+} // namespace nsTransition
+
+#endif // TRANSITION_EASING_H
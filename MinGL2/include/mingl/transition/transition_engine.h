@@ -12,8 +12,7 @@
 #define TRANSITION_ENGINE_H
 
 #include <chrono>
-#include <memory>
-#include <list>
+#include <vector>
 
 #include "transition.h"
 
@@ -34,6 +33,7 @@ public:
      *
      * Cette fonction rajoute la valeur de delta aux temps écoulés des différentes transitions,
      * et supprime les transitions terminées de la liste.
+     * Le temps actuel n'est lu qu'une seule fois par appel, puis partagé par toutes les transitions.
      */
     void update(const std::chrono::microseconds& delta);
 
@@ -41,9 +41,24 @@ public:
      * @brief Démarre un contrat
      * @param[in] contract : Contrat de transition a démarrer
      * @fn void startContract(const TransitionContract &contract);
+     *
+     * Un contrat démarré pendant update() (depuis un callback) est mis en attente, et rejoint la liste a la fin de update().
      */
     void startContract(const TransitionContract& contract);
 
+    /**
+     * @brief Réserve la place pour un certain nombre de transitions simultanées
+     * @param[in] count : Nombre de transitions a réserver
+     * @fn void reserve(const size_t& count);
+     */
+    void reserve(const size_t& count);
+
+    /**
+     * @brief Retourne le nombre de transitions gérées par ce moteur
+     * @fn size_t getTransitionCount() const;
+     */
+    size_t getTransitionCount() const;
+
     /**
      * @brief Termine toutes les transitions de la liste
      * @param[in] finishMode : finishMode : Mode utilisé pour finir cette Transition (Valeurs d'arrivé par défaut)
@@ -63,12 +78,24 @@ private:
     /**
      * @brief TransitionVector_t : Définition de type représentant une liste de transition
      */
-    typedef std::list<Transition> TransitionVector_t;
+    typedef std::vector<Transition> TransitionVector_t;
 
     /**
-     * @brief m_transitionList : Liste des transitions que ce moteur gère
+     * @brief m_transitionList : Liste des transitions que ce moteur gère, stockées de façon contiguë
+     *
+     * L'ordre n'est pas conservé : une transition terminée est remplacée par la dernière de la liste.
      */
     TransitionVector_t m_transitionList;
+
+    /**
+     * @brief m_pendingList : Transitions démarrées pendant update(), ajoutées a m_transitionList a la fin de update()
+     */
+    TransitionVector_t m_pendingList;
+
+    /**
+     * @brief m_updating : Vrai pendant update(), m_transitionList ne doit alors pas être réallouée
+     */
+    bool m_updating = false;
 }; // class TransitionEngine
 
 } // namespace nsTransition
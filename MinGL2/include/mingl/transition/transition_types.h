@@ -12,6 +12,12 @@
 #define TRANSITION_TYPES_H
 
 #include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+#include "../exception/cexception.h"
 
 namespace nsTransition
 {
@@ -26,6 +32,199 @@ typedef std::chrono::duration<float, std::nano> SystemDuration_t;
  */
 typedef std::chrono::time_point<std::chrono::steady_clock, SystemDuration_t> SystemTimePoint_t;
 
+/**
+ * @brief Nombre de composantes des valeurs les plus courantes, connu a la compilation
+ */
+enum : size_t {
+    KScalarComponents = 1, /**< Une valeur seule (rayon, épaisseur, ...) */
+    KPositionComponents = 2, /**< Une position (X, Y) */
+    KColorRGBComponents = 3, /**< Une couleur (rouge, vert, bleu) */
+    KColorAlphaComponents = 1, /**< Une transparence */
+};
+
+/**
+ * @class BasicValueSpan
+ * @brief Vue (non propriétaire) sur une suite contiguë de valeurs de transition
+ * @tparam T : Type des valeurs (float ou const float)
+ */
+template <typename T>
+class BasicValueSpan
+{
+public:
+    /**
+     * @brief Constructeur pour la classe BasicValueSpan
+     * @param[in] data : Pointeur vers la première valeur
+     * @param[in] size : Nombre de valeurs
+     * @fn BasicValueSpan(T* data, const size_t& size);
+     */
+    BasicValueSpan(T* data, const size_t& size)
+        : m_data(data)
+        , m_size(size)
+    {} // BasicValueSpan()
+
+    /**
+     * @brief Constructeur pour la classe BasicValueSpan, vue sur tout un vecteur
+     * @param[in] values : Vecteur a observer
+     * @fn template <typename U> BasicValueSpan(std::vector<U>& values);
+     */
+    template <typename U>
+    BasicValueSpan(std::vector<U>& values)
+        : m_data(values.data())
+        , m_size(values.size())
+    {} // BasicValueSpan()
+
+    template <typename U>
+    BasicValueSpan(const std::vector<U>& values)
+        : m_data(values.data())
+        , m_size(values.size())
+    {} // BasicValueSpan()
+
+    /**
+     * @brief Constructeur de conversion, permet de passer une vue modifiable la ou une vue constante est attendue
+     * @fn template <typename U> BasicValueSpan(const BasicValueSpan<U>& other);
+     */
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    BasicValueSpan(const BasicValueSpan<U>& other)
+        : m_data(other.data())
+        , m_size(other.size())
+    {} // BasicValueSpan()
+
+    T* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    T* begin() const { return m_data; }
+    T* end() const { return m_data + m_size; }
+    T& operator[](const size_t& index) const { return m_data[index]; }
+
+private:
+    /**
+     * @brief m_data : Pointeur vers la première valeur
+     */
+    T* m_data;
+
+    /**
+     * @brief m_size : Nombre de valeurs
+     */
+    size_t m_size;
+}; // class BasicValueSpan
+
+/**
+ * @brief ValueSpan_t : Vue modifiable sur des valeurs de transition
+ */
+typedef BasicValueSpan<float> ValueSpan_t;
+
+/**
+ * @brief ConstValueSpan_t : Vue en lecture seule sur des valeurs de transition
+ */
+typedef BasicValueSpan<const float> ConstValueSpan_t;
+
+/**
+ * @class TransitionValues
+ * @brief Stockage de taille fixe pour les valeurs d'une transition, sans allocation dynamique
+ *
+ * Aucune cible ne transitionne plus de KMaxValues composantes a la fois (une couleur RGB en a trois).
+ */
+class TransitionValues
+{
+public:
+    /**
+     * @brief KMaxValues : Nombre maximum de composantes
+     */
+    enum : size_t { KMaxValues = 4 };
+
+    /**
+     * @brief Constructeur par défaut pour la classe TransitionValues, sans aucune composante
+     * @fn TransitionValues();
+     */
+    TransitionValues()
+        : m_size(0)
+    {} // TransitionValues()
+
+    /**
+     * @brief Constructeur pour la classe TransitionValues, a partir d'un vecteur
+     * @param[in] values : Valeurs a copier
+     * @fn TransitionValues(const std::vector<float>& values);
+     * @throws CException (KErrArg) si le vecteur contient plus de KMaxValues valeurs
+     */
+    TransitionValues(const std::vector<float>& values)
+        : TransitionValues(ConstValueSpan_t(values))
+    {} // TransitionValues()
+
+    /**
+     * @brief Constructeur pour la classe TransitionValues, a partir d'une vue
+     * @param[in] values : Valeurs a copier
+     * @fn TransitionValues(const ConstValueSpan_t& values);
+     * @throws CException (KErrArg) si la vue contient plus de KMaxValues valeurs
+     */
+    TransitionValues(const ConstValueSpan_t& values)
+        : m_size(0)
+    {
+        resize(values.size());
+
+        for (size_t i = 0; i < m_size; ++i)
+            m_values[i] = values[i];
+    } // TransitionValues()
+
+    /**
+     * @brief Constructeur pour la classe TransitionValues, a partir d'une liste
+     * @param[in] values : Valeurs a copier
+     * @fn TransitionValues(std::initializer_list<float> values);
+     * @throws CException (KErrArg) si la liste contient plus de KMaxValues valeurs
+     */
+    TransitionValues(std::initializer_list<float> values)
+        : TransitionValues(ConstValueSpan_t(values.begin(), values.size()))
+    {} // TransitionValues()
+
+    /**
+     * @brief Change le nombre de composantes, les nouvelles composantes ne sont pas initialisées
+     * @param[in] size : Nouveau nombre de composantes
+     * @fn void resize(const size_t& size);
+     * @throws CException (KErrArg) si size est plus grand que KMaxValues
+     */
+    void resize(const size_t& size)
+    {
+        if (size > KMaxValues)
+            throw nsException::CException("too many transition values", nsException::KErrArg);
+
+        m_size = size;
+    } // resize()
+
+    /**
+     * @brief Retourne le nombre de composantes
+     * @fn size_t size() const;
+     */
+    size_t size() const { return m_size; }
+
+    /**
+     * @brief Retourne un pointeur vers la première composante
+     * @fn const float* data() const;
+     */
+    const float* data() const { return m_values; }
+    float* data() { return m_values; }
+
+    const float* begin() const { return m_values; }
+    const float* end() const { return m_values + m_size; }
+
+    const float& operator[](const size_t& index) const { return m_values[index]; }
+    float& operator[](const size_t& index) { return m_values[index]; }
+
+    /**
+     * @brief Conversions vers une vue sur les composantes utilisées
+     */
+    operator ValueSpan_t() { return ValueSpan_t(m_values, m_size); }
+    operator ConstValueSpan_t() const { return ConstValueSpan_t(m_values, m_size); }
+
+private:
+    /**
+     * @brief m_values : Composantes stockées
+     */
+    float m_values[KMaxValues];
+
+    /**
+     * @brief m_size : Nombre de composantes utilisées
+     */
+    size_t m_size;
+}; // class TransitionValues
+
 } // namespace nsTransition
 
 #endif // TRANSITION_TYPES_H
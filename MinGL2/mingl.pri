@@ -1,12 +1,28 @@
-macos:LIBS += -L"/usr/local/opt/freeglut/lib" -L"/usr/local/opt/sfml/lib" -framework OpenGL
-LIBS += -L"/../../opt/SFML/lib/x86_64-linux-gnu" -lglut -lsfml-system -lsfml-audio
+macos:LIBS += -L"/usr/local/opt/freeglut/lib" -framework OpenGL
+LIBS += -lglut
 !macos:LIBS += -lGLU -lGL
 
+# qmake CONFIG+=no_sfml : compile sans SFML, AudioEngine utilise alors NullBackend par défaut
+no_sfml {
+    DEFINES += MINGL_NO_SFML
+} else {
+    macos:LIBS += -L"/usr/local/opt/sfml/lib"
+    LIBS += -L"/../../opt/SFML/lib/x86_64-linux-gnu" -lsfml-system -lsfml-audio
+    SOURCES += $$PWD/src/audio/sfml_backend.cpp
+    HEADERS += $$PWD/include/mingl/audio/sfml_backend.h
+}
+
+# Thread de chargement d'AudioEngine
+CONFIG += thread
+unix:LIBS += -pthread
+
 INCLUDEPATH += $$PWD/include/ "/../../opt/SFML/include/"
 macos:INCLUDEPATH += /usr/local/opt/freeglut/include /usr/local/opt/sfml/include
 
 SOURCES += \
     $$PWD/src/audio/audioengine.cpp \
+    $$PWD/src/audio/null_backend.cpp \
+    $$PWD/src/audio/offline_mixer.cpp \
     $$PWD/src/exception/cexception.cpp \
     $$PWD/src/mingl.cpp \
     $$PWD/src/event/event_manager.cpp \
@@ -15,17 +31,22 @@ SOURCES += \
     $$PWD/src/shape/rectangle.cpp \
     $$PWD/src/shape/triangle.cpp \
     $$PWD/src/shape/shape.cpp \
-    $$PWD/src/graphics/rgbacolor.cpp \
-    $$PWD/src/graphics/vec2d.cpp \
+    $$PWD/src/graphics/cachedlayer.cpp \
+    $$PWD/src/graphics/color_ops.cpp \
+    $$PWD/src/gui/asset_bundle.cpp \
     $$PWD/src/gui/glut_font.cpp \
     $$PWD/src/gui/sprite.cpp \
+    $$PWD/src/gui/sprite_atlas.cpp \
     $$PWD/src/gui/text.cpp \
     $$PWD/src/transition/transition.cpp \
     $$PWD/src/transition/transition_contract.cpp \
     $$PWD/src/transition/transition_engine.cpp
 
 HEADERS += \
+    $$PWD/include/mingl/audio/audio_backend.h \
     $$PWD/include/mingl/audio/audioengine.h \
+    $$PWD/include/mingl/audio/null_backend.h \
+    $$PWD/include/mingl/audio/offline_mixer.h \
     $$PWD/include/mingl/exception/cexception.h \
     $$PWD/include/mingl/exception/cexception.hpp \
     $$PWD/include/mingl/exception/errcode.h \
@@ -38,17 +59,30 @@ HEADERS += \
     $$PWD/include/mingl/shape/rectangle.h \
     $$PWD/include/mingl/shape/triangle.h \
     $$PWD/include/mingl/shape/shape.h \
+    $$PWD/include/mingl/graphics/cachedlayer.h \
     $$PWD/include/mingl/graphics/idrawable.h \
+    $$PWD/include/mingl/graphics/rect.h \
+    $$PWD/include/mingl/graphics/rect.hpp \
+    $$PWD/include/mingl/graphics/color_ops.h \
     $$PWD/include/mingl/graphics/rgbacolor.h \
+    $$PWD/include/mingl/graphics/rgbacolor.hpp \
     $$PWD/include/mingl/graphics/vec2d.h \
+    $$PWD/include/mingl/graphics/vec2d.hpp \
+    $$PWD/include/mingl/graphics/vec2f.h \
+    $$PWD/include/mingl/graphics/vec2f.hpp \
+    $$PWD/include/mingl/gui/asset_bundle.h \
     $$PWD/include/mingl/gui/glut_font.h \
     $$PWD/include/mingl/gui/sprite.h \
+    $$PWD/include/mingl/gui/sprite_atlas.h \
     $$PWD/include/mingl/gui/text.h \
     $$PWD/include/mingl/tools/ieditable.h \
     $$PWD/include/mingl/tools/ieditable.hpp \
     $$PWD/include/mingl/tools/ifonctorunaire.hpp \
     $$PWD/include/mingl/transition/itransitionable.h \
     $$PWD/include/mingl/transition/transition.h \
+    $$PWD/include/mingl/transition/transition.hpp \
     $$PWD/include/mingl/transition/transition_contract.h \
+    $$PWD/include/mingl/transition/transition_contract.hpp \
+    $$PWD/include/mingl/transition/transition_easing.h \
     $$PWD/include/mingl/transition/transition_engine.h \
     $$PWD/include/mingl/transition/transition_types.h
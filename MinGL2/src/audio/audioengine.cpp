@@ -3,7 +3,7 @@
  * @file    audioengine.cpp
  * @author  Clément Mathieu--Drif
  * @date    Septembre 2020
- * @version 1.1
+ * @version 1.4
  * @brief   Gestionnaire audio de minGL
  *
  **/
@@ -11,105 +11,413 @@
 #include "mingl/audio/audioengine.h"
 #include "mingl/exception/cexception.h"
 
+#ifdef MINGL_NO_SFML
+#include "mingl/audio/null_backend.h"
+#else
+#include "mingl/audio/sfml_backend.h"
+#endif
+
 using namespace std;
 
+namespace
+{
+// Bits de l'identifiant d'un son réservés a l'indice de la voix (KMaxVoices = 2^8)
+const unsigned KVoiceIndexBits = 8;
+const nsAudio::VoiceHandle_t KVoiceIndexMask = (nsAudio::VoiceHandle_t(1) << KVoiceIndexBits) - 1;
+} // namespace
+
+nsAudio::AudioEngine::AudioEngine(const size_t& voiceCount /* = KDefaultVoiceCount */)
+#ifdef MINGL_NO_SFML
+    : AudioEngine(unique_ptr<IAudioBackend>(new NullBackend), voiceCount)
+#else
+    : AudioEngine(unique_ptr<IAudioBackend>(new SfmlBackend), voiceCount)
+#endif
+{} // AudioEngine()
+
+nsAudio::AudioEngine::AudioEngine(std::unique_ptr<IAudioBackend> backend, const size_t& voiceCount /* = KDefaultVoiceCount */)
+    : m_backend(move(backend))
+{
+    if (!m_backend)
+        throw nsException::CException("missing audio backend", nsException::KErrArg);
+    if (voiceCount == 0 || voiceCount > KMaxVoices)
+        throw nsException::CException("invalid voice count", nsException::KErrArg);
+
+    m_voices.resize(voiceCount);
+    m_backend->setVoiceCount(voiceCount);
+} // AudioEngine()
+
+nsAudio::AudioEngine::~AudioEngine()
+{
+    {
+        lock_guard<mutex> lock(m_loaderMutex);
+        m_stopLoader = true;
+    }
+    m_loaderCondition.notify_one();
+
+    if (m_loader.joinable())
+        m_loader.join();
+} // ~AudioEngine()
+
+nsAudio::IAudioBackend& nsAudio::AudioEngine::getBackend()
+{
+    return *m_backend;
+} // getBackend()
+
 void nsAudio::AudioEngine::setMusic(const std::string& fileName, bool loop /* = true */)
 {
-    if (!m_music.openFromFile(fileName))
+    DecodedSoundPtr_t music = m_backend->openStream(fileName);
+    if (!music)
         throw nsException::CException(fileName + " cannot be loaded", nsException::KFileError);
 
-    m_music.setLoop(loop);
+    // Une musique demandée plus tôt de façon asynchrone ne doit pas remplacer celle-ci
+    m_musicRequest = 0;
+    m_backend->setMusic(move(music), loop);
 } // setMusic()
 
 void nsAudio::AudioEngine::toggleMusicPlaying()
 {
-    setMusicPlaying(m_music.getStatus() != sf::Music::Status::Playing);
+    setMusicPlaying(!isMusicPlaying());
 } // toggleMusic()
 
 void nsAudio::AudioEngine::setMusicPlaying(bool playing)
 {
-    if (playing)
-        m_music.play();
-    else
-        m_music.pause();
+    m_backend->setMusicPlaying(playing);
 } // setMusicPlaying()
 
 bool nsAudio::AudioEngine::isMusicPlaying() const
 {
-    return m_music.getStatus() == sf::Music::Status::Playing;
+    return m_backend->isMusicPlaying();
 } // isMusicPlaying()
 
-void nsAudio::AudioEngine::loadSound(const std::string & fileName)
+nsAudio::SoundHandle_t nsAudio::AudioEngine::loadSound(const std::string & fileName)
 {
-    for(list<pair<string, sf::SoundBuffer>>::iterator it(m_buffers.begin()); it != m_buffers.end(); ++it)
-        if(it->first == fileName)
-            return;
-    sf::SoundBuffer sb;
-    if(!sb.loadFromFile(fileName))
+    const SoundHandle_t existing = findSound(fileName);
+    if (existing != KInvalidSoundHandle)
+        return existing;
+
+    DecodedSoundPtr_t sound = m_backend->decodeSound(fileName);
+    if(!sound)
         throw nsException::CException(fileName + " cannot be loaded", nsException::KFileError);
-    m_buffers.push_front(make_pair(fileName, sb));
+
+    const SoundHandle_t handle = m_bufferStates.size();
+    m_backend->setBuffer(handle, move(sound));
+    m_bufferStates.push_back(SOUND_READY);
+    m_bufferHandles.emplace(fileName, handle);
+    return handle;
 } // loadSound()
 
-void nsAudio::AudioEngine::removeBuffer(const std::string & fileName)
+nsAudio::SoundHandle_t nsAudio::AudioEngine::loadSoundAsync(const std::string& fileName)
+{
+    const SoundHandle_t existing = findSound(fileName);
+    if (existing != KInvalidSoundHandle)
+        return existing;
+
+    const SoundHandle_t handle = m_bufferStates.size();
+    m_bufferStates.push_back(SOUND_LOADING);
+    m_bufferHandles.emplace(fileName, handle);
+
+    LoadJob job;
+    job.kind = LoadJob::LOAD_BUFFER;
+    job.fileName = fileName;
+    job.handle = handle;
+    queueJob(move(job));
+    return handle;
+} // loadSoundAsync()
+
+nsAudio::SoundState nsAudio::AudioEngine::getSoundState(const SoundHandle_t& handle) const
+{
+    return handle < m_bufferStates.size() ? m_bufferStates[handle] : SOUND_UNLOADED;
+} // getSoundState()
+
+bool nsAudio::AudioEngine::isSoundReady(const SoundHandle_t& handle) const
+{
+    return getSoundState(handle) == SOUND_READY;
+} // isSoundReady()
+
+void nsAudio::AudioEngine::setMusicAsync(const std::string& fileName, bool loop /* = true */, bool playWhenReady /* = true */)
+{
+    LoadJob job;
+    job.kind = LoadJob::LOAD_MUSIC;
+    job.fileName = fileName;
+    job.request = m_musicRequest = m_nextMusicRequest++;
+    job.loop = loop;
+    job.play = playWhenReady;
+    queueJob(move(job));
+} // setMusicAsync()
+
+bool nsAudio::AudioEngine::isMusicLoading() const
+{
+    return m_musicRequest != 0;
+} // isMusicLoading()
+
+void nsAudio::AudioEngine::playSoundFromFileAsync(const std::string& fileName)
 {
-    for(list<pair<string, sf::SoundBuffer>>::iterator it(m_buffers.begin()); it != m_buffers.end(); ++it)
+    LoadJob job;
+    job.kind = LoadJob::LOAD_STREAM;
+    job.fileName = fileName;
+    queueJob(move(job));
+} // playSoundFromFileAsync()
+
+void nsAudio::AudioEngine::update()
+{
+    {
+        lock_guard<mutex> lock(m_loaderMutex);
+        if (m_finishedJobs.empty())
+            return;
+        m_installedJobs.swap(m_finishedJobs);
+    }
+
+    for (LoadJob& job : m_installedJobs)
     {
-        if(it->first == fileName)
+        if (!job.result)
+            ++m_loadErrorCount;
+
+        switch (job.kind)
         {
-            m_buffers.erase(it);
+            case LoadJob::LOAD_BUFFER:
+                // Le buffer a pu être retiré pendant son chargement
+                if (m_bufferStates[job.handle] != SOUND_LOADING)
+                    break;
+                if (!job.result)
+                {
+                    m_bufferStates[job.handle] = SOUND_FAILED;
+                    break;
+                }
+                m_backend->setBuffer(job.handle, move(job.result));
+                m_bufferStates[job.handle] = SOUND_READY;
+                break;
+
+            case LoadJob::LOAD_MUSIC:
+                // Seule la dernière demande compte
+                if (job.request != m_musicRequest)
+                    break;
+                m_musicRequest = 0;
+                if (!job.result)
+                    break;
+                m_backend->setMusic(move(job.result), job.loop);
+                if (job.play)
+                    m_backend->setMusicPlaying(true);
+                break;
+
+            case LoadJob::LOAD_STREAM:
+                if (job.result)
+                    m_backend->playStream(move(job.result));
+                break;
+        }
+    }
+    m_installedJobs.clear();
+} // update()
+
+unsigned long long nsAudio::AudioEngine::getLoadErrorCount() const
+{
+    return m_loadErrorCount;
+} // getLoadErrorCount()
+
+void nsAudio::AudioEngine::queueJob(LoadJob&& job)
+{
+    {
+        lock_guard<mutex> lock(m_loaderMutex);
+        m_pendingJobs.push_back(move(job));
+    }
+
+    if (!m_loader.joinable())
+        m_loader = thread(&AudioEngine::loaderLoop, this);
+    m_loaderCondition.notify_one();
+} // queueJob()
+
+void nsAudio::AudioEngine::loaderLoop()
+{
+    unique_lock<mutex> lock(m_loaderMutex);
+    for (;;)
+    {
+        m_loaderCondition.wait(lock, [this]() { return m_stopLoader || !m_pendingJobs.empty(); });
+        if (m_stopLoader)
+            return;
+
+        LoadJob job(move(m_pendingJobs.front()));
+        m_pendingJobs.pop_front();
+
+        // La lecture du fichier se fait sans bloquer le thread du jeu
+        lock.unlock();
+        job.result = (job.kind == LoadJob::LOAD_BUFFER) ? m_backend->decodeSound(job.fileName)
+                                                        : m_backend->openStream(job.fileName);
+        lock.lock();
+
+        m_finishedJobs.push_back(move(job));
+    }
+} // loaderLoop()
+
+nsAudio::SoundHandle_t nsAudio::AudioEngine::findSound(const std::string& fileName) const
+{
+    unordered_map<string, SoundHandle_t>::const_iterator it(m_bufferHandles.find(fileName));
+    return it == m_bufferHandles.end() ? KInvalidSoundHandle : it->second;
+} // findSound()
+
+void nsAudio::AudioEngine::removeBuffer(const SoundHandle_t& handle)
+{
+    if (getSoundState(handle) == SOUND_UNLOADED)
+        throw nsException::CException("invalid sound handle", nsException::KErrArg);
+
+    releaseBuffer(handle);
+    for(unordered_map<string, SoundHandle_t>::iterator it(m_bufferHandles.begin()); it != m_bufferHandles.end(); ++it)
+    {
+        if(it->second == handle)
+        {
+            m_bufferHandles.erase(it);
             return;
         }
     }
-    throw nsException::CException(fileName + " does not exist", nsException::KErrArg);
+} // removeBuffer()
+
+void nsAudio::AudioEngine::removeBuffer(const std::string & fileName)
+{
+    const SoundHandle_t handle = findSound(fileName);
+    if (handle == KInvalidSoundHandle)
+        throw nsException::CException(fileName + " does not exist", nsException::KErrArg);
+
+    removeBuffer(handle);
 } // removeBuffer()
 
 void nsAudio::AudioEngine::emptyBufferList()
 {
-    m_buffers.clear();
+    // Les identifiants ne sont pas réattribués : la table garde sa taille
+    for (SoundHandle_t handle = 0; handle < m_bufferStates.size(); ++handle)
+        if (m_bufferStates[handle] != SOUND_UNLOADED)
+            releaseBuffer(handle);
+    m_bufferHandles.clear();
 } // emptyBufferList()
 
 void nsAudio::AudioEngine::startMusicFromBeginning()
 {
-    m_music.stop();
-    m_music.play();
+    m_backend->restartMusic();
 } // startMusicFromBeginning()
 
-void nsAudio::AudioEngine::playSoundFromBuffer(const std::string& fileName)
+nsAudio::VoiceHandle_t nsAudio::AudioEngine::playSound(const SoundHandle_t& handle, int priority /* = 0 */)
 {
-    bool ok(false);
-    for(list<pair<string, sf::SoundBuffer>>::iterator it(m_buffers.begin()); it != m_buffers.end(); ++it)
+    const SoundState state = getSoundState(handle);
+    if (state == SOUND_LOADING)
+        return KInvalidVoiceHandle;
+    if (state != SOUND_READY)
+        throw nsException::CException("invalid sound handle", nsException::KErrArg);
+
+    // Prend la première voix libre, sinon la moins prioritaire et la plus ancienne
+    size_t chosen = 0;
+    bool isFree = false;
+    for (size_t i = 0; i < m_voices.size(); ++i)
     {
-        if(it->first == fileName)
+        if (!m_backend->isVoicePlaying(i))
         {
-            m_sounds.emplace_front(it->second);
-            m_sounds.front().play();
-            ok = true;
+            chosen = i;
+            isFree = true;
+            break;
         }
+
+        const Voice& voice = m_voices[i];
+        const Voice& victim = m_voices[chosen];
+        if (voice.priority < victim.priority || (voice.priority == victim.priority && voice.serial < victim.serial))
+            chosen = i;
     }
-    if(!ok)
+
+    Voice& voice = m_voices[chosen];
+    if (!isFree)
+    {
+        if (voice.priority > priority)
+        {
+            ++m_dropCount;
+            return KInvalidVoiceHandle;
+        }
+
+        ++m_stealCount;
+    }
+
+    voice.buffer = handle;
+    voice.priority = priority;
+    voice.serial = m_nextSerial++;
+    m_backend->playVoice(chosen, handle);
+
+    return (voice.serial << KVoiceIndexBits) | chosen;
+} // playSound()
+
+bool nsAudio::AudioEngine::isVoicePlaying(const VoiceHandle_t& voice) const
+{
+    const size_t index = findVoice(voice);
+    return index != m_voices.size() && m_backend->isVoicePlaying(index);
+} // isVoicePlaying()
+
+void nsAudio::AudioEngine::stopVoice(const VoiceHandle_t& voice)
+{
+    const size_t index = findVoice(voice);
+    if (index != m_voices.size())
+        m_backend->stopVoice(index);
+} // stopVoice()
+
+size_t nsAudio::AudioEngine::getVoiceCount() const
+{
+    return m_voices.size();
+} // getVoiceCount()
+
+size_t nsAudio::AudioEngine::getActiveVoiceCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < m_voices.size(); ++i)
+        if (m_backend->isVoicePlaying(i))
+            ++count;
+    return count;
+} // getActiveVoiceCount()
+
+unsigned long long nsAudio::AudioEngine::getStealCount() const
+{
+    return m_stealCount;
+} // getStealCount()
+
+unsigned long long nsAudio::AudioEngine::getDropCount() const
+{
+    return m_dropCount;
+} // getDropCount()
+
+void nsAudio::AudioEngine::resetVoiceCounters()
+{
+    m_stealCount = 0;
+    m_dropCount = 0;
+} // resetVoiceCounters()
+
+size_t nsAudio::AudioEngine::findVoice(const VoiceHandle_t& voice) const
+{
+    if (voice == KInvalidVoiceHandle)
+        return m_voices.size();
+
+    const size_t index = voice & KVoiceIndexMask;
+    if (index >= m_voices.size() || m_voices[index].serial != (voice >> KVoiceIndexBits))
+        return m_voices.size();
+
+    return index;
+} // findVoice()
+
+void nsAudio::AudioEngine::releaseBuffer(const SoundHandle_t& handle)
+{
+    if (m_bufferStates[handle] == SOUND_READY)
+        m_backend->releaseBuffer(handle);
+    m_bufferStates[handle] = SOUND_UNLOADED;
+
+    for (Voice& voice : m_voices)
+        if (voice.buffer == handle)
+            voice.buffer = KInvalidSoundHandle;
+} // releaseBuffer()
+
+void nsAudio::AudioEngine::playSoundFromBuffer(const std::string& fileName)
+{
+    const SoundHandle_t handle = findSound(fileName);
+    if (handle == KInvalidSoundHandle)
         throw nsException::CException(fileName + " buffer not found", nsException::KErrArg);
 
-    removeOldSounds();
+    playSound(handle);
 } // playSoundFromBuffer()
 
 void nsAudio::AudioEngine::playSoundFromFile(const std::string& fileName)
 {
-    m_soundsFromFiles.emplace_back();
-    if (!m_soundsFromFiles.back().openFromFile(fileName))
+    DecodedSoundPtr_t stream = m_backend->openStream(fileName);
+    if (!stream)
         throw nsException::CException("file cannot be loaded", nsException::KFileError);
 
-    m_soundsFromFiles.back().play();
-
-    removeOldSounds();
+    m_backend->playStream(move(stream));
 } // playSoundEffects()
-
-void nsAudio::AudioEngine::removeOldSounds()
-{
-    for(list<sf::Sound>::iterator it(m_sounds.begin()); it != m_sounds.end(); ++it)
-        if(it->getStatus() != sf::Sound::Status::Playing)
-            it = m_sounds.erase(it);
-
-    for(list<sf::Music>::iterator it(m_soundsFromFiles.begin()); it != m_soundsFromFiles.end(); ++it)
-        if(it->getStatus() != sf::Sound::Status::Playing)
-            it = m_soundsFromFiles.erase(it);
-} // removeOldSounds()
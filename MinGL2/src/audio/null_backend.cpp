@@ -0,0 +1,80 @@
+/**
+ *
+ * @file    null_backend.cpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Moteur de rendu audio muet
+ *
+ **/
+
+#include "mingl/audio/null_backend.h"
+
+namespace
+{
+
+struct NullSound : public nsAudio::IDecodedSound
+{}; // struct NullSound
+
+} // namespace
+
+void nsAudio::NullBackend::setVoiceCount(const size_t& /*voiceCount*/)
+{} // setVoiceCount()
+
+nsAudio::DecodedSoundPtr_t nsAudio::NullBackend::decodeSound(const std::string& /*fileName*/) const
+{
+    return DecodedSoundPtr_t(new NullSound);
+} // decodeSound()
+
+nsAudio::DecodedSoundPtr_t nsAudio::NullBackend::openStream(const std::string& /*fileName*/) const
+{
+    return DecodedSoundPtr_t(new NullSound);
+} // openStream()
+
+void nsAudio::NullBackend::setBuffer(const SoundHandle_t& /*handle*/, DecodedSoundPtr_t /*sound*/)
+{} // setBuffer()
+
+void nsAudio::NullBackend::releaseBuffer(const SoundHandle_t& /*handle*/)
+{} // releaseBuffer()
+
+void nsAudio::NullBackend::playVoice(const size_t& /*voice*/, const SoundHandle_t& /*handle*/)
+{
+    ++m_playCount;
+} // playVoice()
+
+void nsAudio::NullBackend::stopVoice(const size_t& /*voice*/)
+{} // stopVoice()
+
+bool nsAudio::NullBackend::isVoicePlaying(const size_t& /*voice*/) const
+{
+    return false;
+} // isVoicePlaying()
+
+void nsAudio::NullBackend::setMusic(DecodedSoundPtr_t /*music*/, bool /*loop*/)
+{
+    m_musicPlaying = false;
+} // setMusic()
+
+void nsAudio::NullBackend::setMusicPlaying(bool playing)
+{
+    m_musicPlaying = playing;
+} // setMusicPlaying()
+
+bool nsAudio::NullBackend::isMusicPlaying() const
+{
+    return m_musicPlaying;
+} // isMusicPlaying()
+
+void nsAudio::NullBackend::restartMusic()
+{
+    m_musicPlaying = true;
+} // restartMusic()
+
+void nsAudio::NullBackend::playStream(DecodedSoundPtr_t /*stream*/)
+{
+    ++m_playCount;
+} // playStream()
+
+unsigned long long nsAudio::NullBackend::getPlayCount() const
+{
+    return m_playCount;
+} // getPlayCount()
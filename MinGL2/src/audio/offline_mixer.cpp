@@ -0,0 +1,365 @@
+/**
+ *
+ * @file    offline_mixer.cpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Moteur de rendu audio logiciel, sans carte son
+ *
+ **/
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "mingl/audio/offline_mixer.h"
+#include "mingl/exception/cexception.h"
+
+using namespace std;
+
+namespace
+{
+
+uint32_t readLE(const vector<char>& bytes, const size_t& offset, const unsigned& size)
+{
+    uint32_t value = 0;
+    for (unsigned i = 0; i < size; ++i)
+        value |= uint32_t(static_cast<unsigned char>(bytes[offset + i])) << (8 * i);
+    return value;
+} // readLE()
+
+void writeLE(ofstream& out, const uint32_t& value, const unsigned& size)
+{
+    for (unsigned i = 0; i < size; ++i)
+        out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+} // writeLE()
+
+// Lit un échantillon du fichier, ramené dans [-1, 1]
+float readSample(const vector<char>& bytes, const size_t& offset, const unsigned& format, const unsigned& bits)
+{
+    if (format == 3) // IEEE float
+    {
+        const uint32_t raw = readLE(bytes, offset, 4);
+        float value;
+        copy(reinterpret_cast<const char*>(&raw), reinterpret_cast<const char*>(&raw) + 4, reinterpret_cast<char*>(&value));
+        return value;
+    }
+
+    switch (bits)
+    {
+        case 8:
+            return (float(static_cast<unsigned char>(bytes[offset])) - 128.f) / 128.f;
+        case 16:
+            return float(int16_t(readLE(bytes, offset, 2))) / 32768.f;
+        default: // 24
+            return float(int32_t(readLE(bytes, offset, 3) << 8) >> 8) / 8388608.f;
+    }
+} // readSample()
+
+int16_t toSample(const float& value)
+{
+    return int16_t(max(-32768.f, min(value * 32768.f, 32767.f)));
+} // toSample()
+
+struct PcmSound : public nsAudio::IDecodedSound
+{
+    std::shared_ptr<const vector<int16_t>> samples;
+}; // struct PcmSound
+
+} // namespace
+
+nsAudio::OfflineMixer::OfflineMixer(const unsigned& sampleRate /* = 44100 */, const unsigned& channelCount /* = 2 */)
+    : m_sampleRate(sampleRate)
+    , m_channelCount(channelCount)
+{
+    if (sampleRate == 0 || channelCount == 0 || channelCount > 2)
+        throw nsException::CException("invalid mixer format", nsException::KErrArg);
+} // OfflineMixer()
+
+void nsAudio::OfflineMixer::setVoiceCount(const size_t& voiceCount)
+{
+    m_voices.assign(voiceCount, Playback());
+} // setVoiceCount()
+
+nsAudio::DecodedSoundPtr_t nsAudio::OfflineMixer::decodeSound(const std::string& fileName) const
+{
+    unique_ptr<PcmSound> sound(new PcmSound);
+    if (!decodeWav(fileName, sound->samples))
+        return nullptr;
+    return DecodedSoundPtr_t(sound.release());
+} // decodeSound()
+
+nsAudio::DecodedSoundPtr_t nsAudio::OfflineMixer::openStream(const std::string& fileName) const
+{
+    // Les flux sont décodés en entier eux aussi : le mixeur n'a pas de thread de lecture
+    return decodeSound(fileName);
+} // openStream()
+
+void nsAudio::OfflineMixer::setBuffer(const SoundHandle_t& handle, DecodedSoundPtr_t sound)
+{
+    if (handle >= m_buffers.size())
+        m_buffers.resize(handle + 1);
+    m_buffers[handle] = static_cast<PcmSound&>(*sound).samples;
+} // setBuffer()
+
+void nsAudio::OfflineMixer::releaseBuffer(const SoundHandle_t& handle)
+{
+    for (Playback& voice : m_voices)
+        if (voice.handle == handle)
+            voice = Playback();
+
+    if (handle < m_buffers.size())
+        m_buffers[handle].reset();
+} // releaseBuffer()
+
+void nsAudio::OfflineMixer::playVoice(const size_t& voice, const SoundHandle_t& handle)
+{
+    Playback& playback = m_voices[voice];
+    if (playback.handle != handle)
+    {
+        playback.samples = m_buffers[handle];
+        playback.handle = handle;
+    }
+    playback.position = 0;
+    playback.playing = true;
+} // playVoice()
+
+void nsAudio::OfflineMixer::stopVoice(const size_t& voice)
+{
+    m_voices[voice].playing = false;
+} // stopVoice()
+
+bool nsAudio::OfflineMixer::isVoicePlaying(const size_t& voice) const
+{
+    return m_voices[voice].playing;
+} // isVoicePlaying()
+
+void nsAudio::OfflineMixer::setMusic(DecodedSoundPtr_t music, bool loop)
+{
+    m_music = Playback();
+    m_music.samples = static_cast<PcmSound&>(*music).samples;
+    m_music.loop = loop;
+} // setMusic()
+
+void nsAudio::OfflineMixer::setMusicPlaying(bool playing)
+{
+    m_music.playing = playing && m_music.samples;
+} // setMusicPlaying()
+
+bool nsAudio::OfflineMixer::isMusicPlaying() const
+{
+    return m_music.playing;
+} // isMusicPlaying()
+
+void nsAudio::OfflineMixer::restartMusic()
+{
+    m_music.position = 0;
+    setMusicPlaying(true);
+} // restartMusic()
+
+void nsAudio::OfflineMixer::playStream(DecodedSoundPtr_t stream)
+{
+    Playback playback;
+    playback.samples = static_cast<PcmSound&>(*stream).samples;
+    playback.playing = true;
+    m_streams.push_back(move(playback));
+} // playStream()
+
+void nsAudio::OfflineMixer::render(const size_t& frameCount)
+{
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    m_accumulator.assign(frameCount * m_channelCount, 0);
+
+    for (Playback& voice : m_voices)
+        if (voice.playing)
+            mix(voice);
+
+    if (m_music.playing)
+        mix(m_music);
+
+    for (size_t i = 0; i < m_streams.size();)
+    {
+        mix(m_streams[i]);
+        if (m_streams[i].playing)
+        {
+            ++i;
+            continue;
+        }
+
+        // Les fichiers terminés sont oubliés, l'ordre n'importe pas
+        swap(m_streams[i], m_streams.back());
+        m_streams.pop_back();
+    }
+
+    // Écrête la somme sur 16 bits
+    const size_t begin = m_samples.size();
+    m_samples.resize(begin + m_accumulator.size());
+    int16_t* out = m_samples.data() + begin;
+    for (size_t i = 0; i < m_accumulator.size(); ++i)
+        out[i] = int16_t(max<int32_t>(-32768, min<int32_t>(m_accumulator[i], 32767)));
+
+    m_renderedFrames += frameCount;
+    m_mixingTime += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start);
+} // render()
+
+const std::vector<int16_t>& nsAudio::OfflineMixer::getSamples() const
+{
+    return m_samples;
+} // getSamples()
+
+void nsAudio::OfflineMixer::clearSamples()
+{
+    m_samples.clear();
+} // clearSamples()
+
+bool nsAudio::OfflineMixer::writeWav(const std::string& fileName) const
+{
+    ofstream out(fileName, ios::binary);
+    if (!out)
+        return false;
+
+    const uint32_t dataSize = uint32_t(m_samples.size() * sizeof(int16_t));
+    out.write("RIFF", 4);
+    writeLE(out, 36 + dataSize, 4);
+    out.write("WAVEfmt ", 8);
+    writeLE(out, 16, 4);                                          // Taille du bloc fmt
+    writeLE(out, 1, 2);                                           // PCM
+    writeLE(out, m_channelCount, 2);
+    writeLE(out, m_sampleRate, 4);
+    writeLE(out, m_sampleRate * m_channelCount * sizeof(int16_t), 4); // Octets par seconde
+    writeLE(out, m_channelCount * sizeof(int16_t), 2);              // Octets par trame
+    writeLE(out, 16, 2);                                          // Bits par échantillon
+    out.write("data", 4);
+    writeLE(out, dataSize, 4);
+    for (const int16_t& sample : m_samples)
+        writeLE(out, uint16_t(sample), 2);
+
+    return bool(out);
+} // writeWav()
+
+unsigned nsAudio::OfflineMixer::getSampleRate() const
+{
+    return m_sampleRate;
+} // getSampleRate()
+
+unsigned nsAudio::OfflineMixer::getChannelCount() const
+{
+    return m_channelCount;
+} // getChannelCount()
+
+unsigned long long nsAudio::OfflineMixer::getRenderedFrameCount() const
+{
+    return m_renderedFrames;
+} // getRenderedFrameCount()
+
+std::chrono::nanoseconds nsAudio::OfflineMixer::getMixingTime() const
+{
+    return m_mixingTime;
+} // getMixingTime()
+
+void nsAudio::OfflineMixer::resetStats()
+{
+    m_renderedFrames = 0;
+    m_mixingTime = chrono::nanoseconds::zero();
+} // resetStats()
+
+bool nsAudio::OfflineMixer::decodeWav(const std::string& fileName, PcmData_t& data) const
+{
+    ifstream in(fileName, ios::binary);
+    if (!in)
+        return false;
+
+    const vector<char> bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    if (bytes.size() < 12 || !equal(bytes.begin(), bytes.begin() + 4, "RIFF") || !equal(bytes.begin() + 8, bytes.begin() + 12, "WAVE"))
+        return false;
+
+    // Parcourt les blocs a la recherche de fmt et data
+    unsigned format = 0, channels = 0, rate = 0, bits = 0;
+    size_t dataOffset = 0, dataSize = 0;
+    for (size_t offset = 12; offset + 8 <= bytes.size();)
+    {
+        const size_t chunkSize = readLE(bytes, offset + 4, 4);
+        const size_t body = offset + 8;
+        if (body + chunkSize > bytes.size())
+            break;
+
+        if (equal(bytes.begin() + offset, bytes.begin() + offset + 4, "fmt ") && chunkSize >= 16)
+        {
+            format = readLE(bytes, body, 2);
+            channels = readLE(bytes, body + 2, 2);
+            rate = readLE(bytes, body + 4, 4);
+            bits = readLE(bytes, body + 14, 2);
+            if (format == 0xFFFE && chunkSize >= 26) // WAVE_FORMAT_EXTENSIBLE : le vrai format est au début du GUID
+                format = readLE(bytes, body + 24, 2);
+        }
+        else if (equal(bytes.begin() + offset, bytes.begin() + offset + 4, "data"))
+        {
+            dataOffset = body;
+            dataSize = chunkSize;
+        }
+
+        offset = body + chunkSize + (chunkSize & 1);
+    }
+
+    const bool supported = (format == 1 && (bits == 8 || bits == 16 || bits == 24)) || (format == 3 && bits == 32);
+    if (!supported || channels == 0 || rate == 0 || dataOffset == 0)
+        return false;
+
+    const size_t frameSize = channels * bits / 8;
+    const size_t sourceFrames = dataSize / frameSize;
+    const size_t frames = size_t(double(sourceFrames) * m_sampleRate / rate);
+
+    // Rééchantillonne linéairement et adapte le nombre de canaux
+    vector<int16_t>* samples = new vector<int16_t>(frames * m_channelCount);
+    data.reset(samples);
+    const double step = double(rate) / m_sampleRate;
+    for (size_t frame = 0; frame < frames; ++frame)
+    {
+        const double position = frame * step;
+        const size_t first = min(size_t(position), sourceFrames - 1);
+        const size_t second = min(first + 1, sourceFrames - 1);
+        const float weight = float(position - first);
+
+        for (unsigned channel = 0; channel < m_channelCount; ++channel)
+        {
+            float value = 0.f;
+            // Un rendu mono moyenne les canaux du fichier, sinon chaque canal prend le sien ou le dernier disponible
+            const unsigned from = (m_channelCount == 1) ? 0 : min(channel, channels - 1);
+            const unsigned to = (m_channelCount == 1) ? channels : from + 1;
+            for (unsigned source = from; source < to; ++source)
+            {
+                const float a = readSample(bytes, dataOffset + first * frameSize + source * bits / 8, format, bits);
+                const float b = readSample(bytes, dataOffset + second * frameSize + source * bits / 8, format, bits);
+                value += a + (b - a) * weight;
+            }
+            (*samples)[frame * m_channelCount + channel] = toSample(value / (to - from));
+        }
+    }
+
+    return true;
+} // decodeWav()
+
+void nsAudio::OfflineMixer::mix(Playback& playback)
+{
+    const vector<int16_t>& samples = *playback.samples;
+    int32_t* out = m_accumulator.data();
+    size_t remaining = m_accumulator.size();
+
+    while (remaining != 0 && playback.playing)
+    {
+        const size_t count = min(remaining, samples.size() - playback.position);
+        const int16_t* in = samples.data() + playback.position;
+        for (size_t i = 0; i < count; ++i)
+            out[i] += in[i];
+
+        out += count;
+        remaining -= count;
+        playback.position += count;
+
+        if (playback.position == samples.size())
+        {
+            playback.position = 0;
+            playback.playing = playback.loop && !samples.empty();
+        }
+    }
+} // mix()
@@ -0,0 +1,161 @@
+/**
+ *
+ * @file    sfml_backend.cpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Moteur de rendu audio basé sur SFML
+ *
+ **/
+
+#include "mingl/audio/sfml_backend.h"
+
+using namespace std;
+
+namespace
+{
+
+struct SfmlSound : public nsAudio::IDecodedSound
+{
+    sf::SoundBuffer buffer;
+}; // struct SfmlSound
+
+struct SfmlStream : public nsAudio::IDecodedSound
+{
+    sf::Music music;
+}; // struct SfmlStream
+
+// Les sons confiés au backend ont tous été produits par lui
+sf::SoundBuffer& bufferOf(const nsAudio::DecodedSoundPtr_t& sound)
+{
+    return static_cast<SfmlSound&>(*sound).buffer;
+} // bufferOf()
+
+sf::Music& musicOf(const nsAudio::DecodedSoundPtr_t& stream)
+{
+    return static_cast<SfmlStream&>(*stream).music;
+} // musicOf()
+
+} // namespace
+
+void nsAudio::SfmlBackend::setVoiceCount(const size_t& voiceCount)
+{
+    for (sf::Sound& voice : m_voices)
+        voice.stop();
+
+    m_voices.resize(voiceCount);
+    m_voiceBuffers.assign(voiceCount, KInvalidSoundHandle);
+} // setVoiceCount()
+
+nsAudio::DecodedSoundPtr_t nsAudio::SfmlBackend::decodeSound(const std::string& fileName) const
+{
+    unique_ptr<SfmlSound> sound(new SfmlSound);
+    if (!sound->buffer.loadFromFile(fileName))
+        return nullptr;
+    return DecodedSoundPtr_t(sound.release());
+} // decodeSound()
+
+nsAudio::DecodedSoundPtr_t nsAudio::SfmlBackend::openStream(const std::string& fileName) const
+{
+    unique_ptr<SfmlStream> stream(new SfmlStream);
+    if (!stream->music.openFromFile(fileName))
+        return nullptr;
+    return DecodedSoundPtr_t(stream.release());
+} // openStream()
+
+void nsAudio::SfmlBackend::setBuffer(const SoundHandle_t& handle, DecodedSoundPtr_t sound)
+{
+    if (handle >= m_buffers.size())
+        m_buffers.resize(handle + 1);
+    m_buffers[handle] = move(sound);
+} // setBuffer()
+
+void nsAudio::SfmlBackend::releaseBuffer(const SoundHandle_t& handle)
+{
+    for (size_t i = 0; i < m_voices.size(); ++i)
+    {
+        if (m_voiceBuffers[i] != handle)
+            continue;
+
+        m_voices[i].stop();
+        m_voices[i].resetBuffer();
+        m_voiceBuffers[i] = KInvalidSoundHandle;
+    }
+
+    if (handle < m_buffers.size())
+        m_buffers[handle].reset();
+} // releaseBuffer()
+
+void nsAudio::SfmlBackend::playVoice(const size_t& voice, const SoundHandle_t& handle)
+{
+    sf::Sound& sound = m_voices[voice];
+    sound.stop();
+
+    // Ne rattache le buffer que s'il change : setBuffer() n'est pas gratuit
+    if (m_voiceBuffers[voice] != handle)
+    {
+        sound.setBuffer(bufferOf(m_buffers[handle]));
+        m_voiceBuffers[voice] = handle;
+    }
+    sound.play();
+} // playVoice()
+
+void nsAudio::SfmlBackend::stopVoice(const size_t& voice)
+{
+    m_voices[voice].stop();
+} // stopVoice()
+
+bool nsAudio::SfmlBackend::isVoicePlaying(const size_t& voice) const
+{
+    return m_voices[voice].getStatus() == sf::Sound::Status::Playing;
+} // isVoicePlaying()
+
+void nsAudio::SfmlBackend::setMusic(DecodedSoundPtr_t music, bool loop)
+{
+    m_music = move(music);
+    musicOf(m_music).setLoop(loop);
+} // setMusic()
+
+void nsAudio::SfmlBackend::setMusicPlaying(bool playing)
+{
+    if (!m_music)
+        return;
+
+    if (playing)
+        musicOf(m_music).play();
+    else
+        musicOf(m_music).pause();
+} // setMusicPlaying()
+
+bool nsAudio::SfmlBackend::isMusicPlaying() const
+{
+    return m_music && musicOf(m_music).getStatus() == sf::Music::Status::Playing;
+} // isMusicPlaying()
+
+void nsAudio::SfmlBackend::restartMusic()
+{
+    if (!m_music)
+        return;
+
+    musicOf(m_music).stop();
+    musicOf(m_music).play();
+} // restartMusic()
+
+void nsAudio::SfmlBackend::playStream(DecodedSoundPtr_t stream)
+{
+    removeOldStreams();
+
+    m_streams.push_back(move(stream));
+    musicOf(m_streams.back()).play();
+} // playStream()
+
+void nsAudio::SfmlBackend::removeOldStreams()
+{
+    list<DecodedSoundPtr_t>::iterator it(m_streams.begin());
+    while (it != m_streams.end())
+    {
+        if (musicOf(*it).getStatus() != sf::Sound::Status::Playing)
+            it = m_streams.erase(it);
+        else
+            ++it;
+    }
+} // removeOldStreams()
@@ -0,0 +1,153 @@
+/**
+ *
+ * @file    cachedlayer.cpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Couche statique mise en cache dans une texture
+ *
+ **/
+
+#include "mingl/graphics/cachedlayer.h"
+#include "mingl/graphics/color_ops.h"
+#include "mingl/graphics/rect.h"
+#include "mingl/gui/sprite.h"
+#include "mingl/mingl.h"
+
+namespace {
+
+int computeNextPowerOfTwo(const int value)
+{
+    int powerOfTwo = 1;
+    while (powerOfTwo < value)
+        powerOfTwo *= 2;
+
+    return powerOfTwo;
+} // computeNextPowerOfTwo()
+
+} // namespace
+
+nsGraphics::CachedLayer::CachedLayer(const Vec2D& position, const Vec2D& size)
+    : m_position(position)
+    , m_size(size)
+    , m_texture(0)
+    , m_valid(false)
+{} // CachedLayer()
+
+nsGraphics::CachedLayer::~CachedLayer()
+{
+    if (m_texture != 0)
+        glDeleteTextures(1, &m_texture);
+} // ~CachedLayer()
+
+void nsGraphics::CachedLayer::addSprite(const nsGui::Sprite& sprite)
+{
+    m_sprites.push_back(&sprite);
+    m_valid = false;
+} // addSprite()
+
+void nsGraphics::CachedLayer::clearSprites()
+{
+    m_sprites.clear();
+    m_valid = false;
+} // clearSprites()
+
+void nsGraphics::CachedLayer::invalidate()
+{
+    m_valid = false;
+} // invalidate()
+
+void nsGraphics::CachedLayer::releaseTexture()
+{
+    if (m_texture != 0)
+        glDeleteTextures(1, &m_texture);
+
+    m_texture = 0;
+    m_valid = false;
+} // releaseTexture()
+
+bool nsGraphics::CachedLayer::isValid() const
+{
+    return m_valid;
+} // isValid()
+
+void nsGraphics::CachedLayer::rebuild(MinGL& window) const
+{
+    m_composedBackground = window.getBackgroundColor();
+    m_valid = true;
+
+    const int width = m_size.getX();
+    const int height = m_size.getY();
+    if (width <= 0 || height <= 0)
+        return;
+
+    // On part de la couleur de fond, opaque : prémultipliée, elle reste la même
+    RGBAcolor background = m_composedBackground;
+    background.setAlpha(255);
+    std::vector<RGBAcolor> pixels(size_t(width) * height, background);
+
+    const Rect layerArea = Rect::fromPositionSize(m_position, m_size);
+    for (const nsGui::Sprite *sprite : m_sprites)
+    {
+        const Rect visibleArea = layerArea.computeIntersection(sprite->computeBounds());
+        if (visibleArea.isEmpty())
+            continue;
+
+        std::vector<RGBAcolor> spritePixels = sprite->computePixelData();
+        if (sprite->getAlphaMode() == nsGui::Sprite::ALPHA_STRAIGHT)
+            premultiplyPixels(spritePixels);
+
+        // Composition ligne par ligne de la partie du sprite qui tombe dans la couche
+        const Vec2D spriteStart = visibleArea.getMin() - sprite->getPosition();
+        const Vec2D layerStart = visibleArea.getMin() - m_position;
+        const Vec2D visibleSize = visibleArea.computeSize();
+        for (int y = 0; y < visibleSize.getY(); ++y)
+            compositePremultipliedPixels(&pixels[size_t(layerStart.getY() + y) * width + layerStart.getX()],
+                                         &spritePixels[size_t(spriteStart.getY() + y) * sprite->getRowSize() + spriteStart.getX()],
+                                         visibleSize.getX());
+    }
+
+    if (m_texture == 0)
+        glGenTextures(1, &m_texture);
+
+    // La texture est allouée en puissances de deux, puis la couche est copiée dans son coin
+    m_textureSize = Vec2D(computeNextPowerOfTwo(width), computeNextPowerOfTwo(height));
+
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_textureSize.getX(), m_textureSize.getY(), 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+} // rebuild()
+
+void nsGraphics::CachedLayer::draw(MinGL& window) const
+{
+    // La couleur de fond est composée dans la texture
+    if (!m_valid || m_composedBackground != window.getBackgroundColor())
+        rebuild(window);
+
+    if (m_texture == 0)
+        return;
+
+    // Un seul quadrilatère texturé, qui n'utilise que le coin de la texture occupé par la couche
+    const float right = float(m_size.getX()) / m_textureSize.getX();
+    const float bottom = float(m_size.getY()) / m_textureSize.getY();
+    const Vec2D end = m_position + m_size;
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glColor4ub(255, 255, 255, 255);
+
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.f, 0.f); glVertex2i(m_position.getX(), m_position.getY());
+    glTexCoord2f(right, 0.f); glVertex2i(end.getX(), m_position.getY());
+    glTexCoord2f(right, bottom); glVertex2i(end.getX(), end.getY());
+    glTexCoord2f(0.f, bottom); glVertex2i(m_position.getX(), end.getY());
+    glEnd();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+} // draw()
@@ -0,0 +1,156 @@
+/**
+ *
+ * @file    color_ops.cpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Traitements de couleur appliqués en bloc a des tableaux de pixels
+ *
+ **/
+
+#include <cstdint>
+
+#include "mingl/graphics/color_ops.h"
+
+namespace
+{
+
+// Les boucles travaillent sur des blocs de 4 pixels, soit 16 octets : RGBAcolor est garantie faire
+// exactement quatre octets R, G, B, A, donc un tableau de pixels est un tableau d'octets contigu,
+// et chaque bloc tient dans un registre vectoriel de 128 bits
+const size_t KBlockBytes = 16;
+
+// Calcule round(a * b / 255) pour a, b dans [0, 255], sans division. Le calcul tient sur 16 bits,
+// ce qui permet au compilateur de traiter 8 composantes par instruction
+inline GLubyte mulDiv255(const uint16_t& a, const uint16_t& b)
+{
+    const uint16_t x = uint16_t(a * b + 128);
+    return GLubyte((x + (x >> 8)) >> 8);
+} // mulDiv255()
+
+// Calcule round((a * (255 - t) + b * t) / 255), soit une interpolation de a vers b
+inline GLubyte lerp255(const uint16_t& a, const uint16_t& b, const uint16_t& t)
+{
+    const uint16_t x = uint16_t(a * (255 - t) + b * t + 128);
+    return GLubyte((x + (x >> 8)) >> 8);
+} // lerp255()
+
+// Répète une couleur sur tout un bloc
+void fillBlock(GLubyte (&block)[KBlockBytes], const nsGraphics::RGBAcolor& color)
+{
+    for (size_t j = 0; j < KBlockBytes; ++j)
+        block[j] = color.data()[j % 4];
+} // fillBlock()
+
+} // namespace
+
+void nsGraphics::tintPixels(RGBAcolor* pixels, const size_t& count, const RGBAcolor& tint)
+{
+    GLubyte* bytes = reinterpret_cast<GLubyte*>(pixels);
+    const size_t size = count * 4;
+
+    GLubyte factors[KBlockBytes];
+    fillBlock(factors, tint);
+
+    size_t i = 0;
+    for (; i + KBlockBytes <= size; i += KBlockBytes)
+        for (size_t j = 0; j < KBlockBytes; ++j)
+            bytes[i + j] = mulDiv255(bytes[i + j], factors[j]);
+
+    for (; i < size; ++i)
+        bytes[i] = mulDiv255(bytes[i], factors[i % 4]);
+} // tintPixels()
+
+void nsGraphics::fadePixels(RGBAcolor* pixels, const size_t& count, const GLubyte& alpha)
+{
+    tintPixels(pixels, count, RGBAcolor(255, 255, 255, alpha));
+} // fadePixels()
+
+void nsGraphics::mixPixels(RGBAcolor* pixels, const size_t& count, const RGBAcolor& color, const GLubyte& amount)
+{
+    GLubyte* bytes = reinterpret_cast<GLubyte*>(pixels);
+    const size_t size = count * 4;
+
+    // Une proportion nulle sur la transparence la laisse inchangée, sans cas particulier dans la boucle
+    GLubyte targets[KBlockBytes];
+    GLubyte amounts[KBlockBytes];
+    fillBlock(targets, color);
+    fillBlock(amounts, RGBAcolor(amount, amount, amount, 0));
+
+    size_t i = 0;
+    for (; i + KBlockBytes <= size; i += KBlockBytes)
+        for (size_t j = 0; j < KBlockBytes; ++j)
+            bytes[i + j] = lerp255(bytes[i + j], targets[j], amounts[j]);
+
+    for (; i < size; ++i)
+        bytes[i] = lerp255(bytes[i], targets[i % 4], amounts[i % 4]);
+} // mixPixels()
+
+void nsGraphics::premultiplyPixels(RGBAcolor* pixels, const size_t& count)
+{
+    GLubyte* bytes = reinterpret_cast<GLubyte*>(pixels);
+    const size_t size = count * 4;
+
+    // La transparence est multipliée par 255, donc inchangée
+    size_t i = 0;
+    for (; i + KBlockBytes <= size; i += KBlockBytes)
+    {
+        GLubyte factors[KBlockBytes];
+        for (size_t pixel = 0; pixel < KBlockBytes; pixel += 4)
+        {
+            factors[pixel] = factors[pixel + 1] = factors[pixel + 2] = bytes[i + pixel + 3];
+            factors[pixel + 3] = 255;
+        }
+
+        for (size_t j = 0; j < KBlockBytes; ++j)
+            bytes[i + j] = mulDiv255(bytes[i + j], factors[j]);
+    }
+
+    for (; i < size; ++i)
+        bytes[i] = (i % 4 == 3) ? bytes[i] : mulDiv255(bytes[i], bytes[i | 3]);
+} // premultiplyPixels()
+
+void nsGraphics::compositePremultipliedPixels(RGBAcolor* destination, const RGBAcolor* source, const size_t& count)
+{
+    GLubyte* bytes = reinterpret_cast<GLubyte*>(destination);
+    const GLubyte* sourceBytes = reinterpret_cast<const GLubyte*>(source);
+    const size_t size = count * 4;
+
+    // Une source prémultipliée valide a chaque composante inférieure a sa transparence : la somme ne dépasse pas 255
+    size_t i = 0;
+    for (; i + KBlockBytes <= size; i += KBlockBytes)
+    {
+        // Copie locale : la source pourrait chevaucher la destination, ce qui empêcherait la vectorisation
+        GLubyte block[KBlockBytes];
+        GLubyte factors[KBlockBytes];
+        for (size_t j = 0; j < KBlockBytes; ++j)
+            block[j] = sourceBytes[i + j];
+        for (size_t pixel = 0; pixel < KBlockBytes; pixel += 4)
+            factors[pixel] = factors[pixel + 1] = factors[pixel + 2] = factors[pixel + 3] = GLubyte(255 - block[pixel + 3]);
+
+        for (size_t j = 0; j < KBlockBytes; ++j)
+            bytes[i + j] = GLubyte(block[j] + mulDiv255(bytes[i + j], factors[j]));
+    }
+
+    for (; i < size; ++i)
+        bytes[i] = GLubyte(sourceBytes[i] + mulDiv255(bytes[i], 255 - sourceBytes[i | 3]));
+} // compositePremultipliedPixels()
+
+void nsGraphics::tintPixels(std::vector<RGBAcolor>& pixels, const RGBAcolor& tint)
+{
+    tintPixels(pixels.data(), pixels.size(), tint);
+} // tintPixels()
+
+void nsGraphics::fadePixels(std::vector<RGBAcolor>& pixels, const GLubyte& alpha)
+{
+    fadePixels(pixels.data(), pixels.size(), alpha);
+} // fadePixels()
+
+void nsGraphics::mixPixels(std::vector<RGBAcolor>& pixels, const RGBAcolor& color, const GLubyte& amount)
+{
+    mixPixels(pixels.data(), pixels.size(), color, amount);
+} // mixPixels()
+
+void nsGraphics::premultiplyPixels(std::vector<RGBAcolor>& pixels)
+{
+    premultiplyPixels(pixels.data(), pixels.size());
+} // premultiplyPixels()
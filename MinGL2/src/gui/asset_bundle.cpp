@@ -0,0 +1,176 @@
+/**
+ *
+ * @file    asset_bundle.cpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Fichiers rangés dans un seul paquet, projeté en mémoire
+ *
+ **/
+
+#include "mingl/gui/asset_bundle.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "mingl/exception/cexception.h"
+
+namespace
+{
+
+// Version du format écrite par tools/si2bundle.py
+const uint16_t KBundleVersion = 1;
+
+} // namespace
+
+nsGui::AssetBundle::AssetBundle(const std::string& filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        std::cerr << "[AssetBundle] Bundle file \"" << filename << "\" could not be opened." << std::endl;
+        throw nsException::CException(filename + " cannot be loaded", nsException::KFileError);
+    }
+
+    struct stat status;
+    void* address = MAP_FAILED;
+    if (fstat(fd, &status) == 0 && size_t(status.st_size) >= sizeof(FileBegin))
+    {
+        m_size = status.st_size;
+        address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+
+    // La projection reste valide une fois le fichier fermé
+    close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        std::cerr << "[AssetBundle] Bundle file \"" << filename << "\" could not be mapped." << std::endl;
+        throw nsException::CException(filename + " cannot be loaded", nsException::KFileError);
+    }
+
+    const size_t size = m_size;
+    m_mapping = std::shared_ptr<const void>(address, [size](const void* mapping) {
+        munmap(const_cast<void*>(mapping), size);
+    });
+
+    if (!readIndex())
+    {
+        std::cerr << "[AssetBundle] Bundle file \"" << filename << "\" is not a valid bundle." << std::endl;
+        throw nsException::CException(filename + " cannot be loaded", nsException::KFileError);
+    }
+} // AssetBundle()
+
+nsGui::AssetBundle::AssetBundle(const void* data, const size_t& size)
+    // Pointeur sans propriétaire : les sprites servis n'ont rien a garder en vie
+    : m_mapping(std::shared_ptr<const void>(), data)
+    , m_size(size)
+{
+    if (data == nullptr || m_size < sizeof(FileBegin) || !readIndex())
+        throw nsException::CException("Invalid bundle data", nsException::KErrArg);
+} // AssetBundle()
+
+bool nsGui::AssetBundle::readIndex()
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(m_mapping.get());
+
+    FileBegin fileBegin;
+    memcpy(&fileBegin, bytes, sizeof(FileBegin));
+    if (memcmp(&fileBegin.magic, "SI2B", 4) != 0 || fileBegin.version != KBundleVersion || fileBegin.fileSize != m_size
+        || sizeof(FileBegin) + fileBegin.entryCount * sizeof(Entry) > m_size)
+        return false;
+
+    const Entry* entries = reinterpret_cast<const Entry*>(bytes + sizeof(FileBegin));
+    for (size_t i = 0; i < fileBegin.entryCount; ++i)
+    {
+        const Entry& entry = entries[i];
+
+        // La dichotomie de findEntry() compte sur des noms terminés par un zéro, uniques et triés
+        if (entry.name[0] == '\0' || entry.name[KNameSize - 1] != '\0'
+            || (i > 0 && strcmp(entries[i - 1].name, entry.name) >= 0)
+            || entry.offset > m_size || entry.size > m_size - entry.offset)
+            return false;
+    }
+
+    m_entries = entries;
+    m_entryCount = fileBegin.entryCount;
+    return true;
+} // readIndex()
+
+const nsGui::AssetBundle::Entry* nsGui::AssetBundle::findEntry(const std::string& name) const
+{
+    if (name.size() >= KNameSize)
+        return nullptr;
+
+    const Entry* end = m_entries + m_entryCount;
+    const Entry* entry = std::lower_bound(m_entries, end, name, [](const Entry& lhs, const std::string& rhs) {
+        return strcmp(lhs.name, rhs.c_str()) < 0;
+    });
+
+    return (entry != end && name == entry->name) ? entry : nullptr;
+} // findEntry()
+
+bool nsGui::AssetBundle::contains(const std::string& name) const
+{
+    return findEntry(name) != nullptr;
+} // contains()
+
+nsGui::AssetBundle::Blob nsGui::AssetBundle::getBlob(const std::string& name) const
+{
+    const Entry* entry = findEntry(name);
+    if (entry == nullptr)
+        throw nsException::CException("No file named " + name + " in bundle", nsException::KErrArg);
+
+    return Blob{static_cast<const uint8_t*>(m_mapping.get()) + entry->offset, entry->size};
+} // getBlob()
+
+nsGui::Sprite nsGui::AssetBundle::getSprite(const std::string& name, const nsGraphics::Vec2D& position,
+                                            const Sprite::AlphaMode& alphaMode) const
+{
+    const Blob blob = getBlob(name);
+    return Sprite(blob.data, blob.size, m_mapping, position, alphaMode);
+} // getSprite()
+
+void nsGui::AssetBundle::prefault(const std::string& name) const
+{
+    const Blob blob = getBlob(name);
+    const size_t pageSize = sysconf(_SC_PAGESIZE);
+
+    // volatile : sans effet visible, la lecture serait supprimée par le compilateur
+    const volatile uint8_t* bytes = blob.data;
+    for (size_t i = 0; i < blob.size; i += pageSize)
+        bytes[i];
+    if (blob.size != 0)
+        bytes[blob.size - 1];
+} // prefault()
+
+void nsGui::AssetBundle::discard(const std::string& name) const
+{
+    const Blob blob = getBlob(name);
+    const uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+
+    // Les pages partagées avec un fichier voisin restent en place
+    const uintptr_t begin = (reinterpret_cast<uintptr_t>(blob.data) + pageSize - 1) / pageSize * pageSize;
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(blob.data) + blob.size) / pageSize * pageSize;
+    if (begin < end)
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+} // discard()
+
+std::vector<std::string> nsGui::AssetBundle::getNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(m_entryCount);
+    for (size_t i = 0; i < m_entryCount; ++i)
+        names.push_back(m_entries[i].name);
+
+    return names;
+} // getNames()
+
+const size_t& nsGui::AssetBundle::getSize() const
+{
+    return m_size;
+} // getSize()
@@ -12,13 +12,43 @@
 
 #include <unistd.h>
 #include <fcntl.h>
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
 #include "mingl/macros.h"
+#include "mingl/mingl.h"
 #include "mingl/exception/cexception.h"
+#include "mingl/graphics/color_ops.h"
 
-nsGui::Sprite::Sprite(const std::string& filename, const nsGraphics::Vec2D& position)
+namespace
+{
+
+// Nombre maximal d'entrées dans la palette d'un sprite indexé
+const size_t KMaxPaletteSize = 256;
+
+// Les pixels d'un .si2 en mémoire sont lus en place, quel que soit leur décalage dans le fichier
+static_assert(alignof(nsGraphics::RGBAcolor) == 1, "RGBAcolor must be readable at any address");
+
+// Lit exactement size octets, read() pouvant en rendre moins
+bool readExactly(const int& fd, void* buffer, const size_t& size)
+{
+    size_t done = 0;
+    while (done < size)
+    {
+        const ssize_t count = read(fd, static_cast<char*>(buffer) + done, size - done);
+        if (count <= 0)
+            return false;
+        done += count;
+    }
+    return true;
+} // readExactly()
+
+} // namespace
+
+nsGui::Sprite::Sprite(const std::string& filename, const nsGraphics::Vec2D& position, const AlphaMode& alphaMode)
     : m_position(position)
+    , m_alphaMode(alphaMode)
 {
     int fd = open(filename.c_str(), O_RDONLY);
     if (fd < 0)
@@ -27,51 +57,273 @@ nsGui::Sprite::Sprite(const std::string& filename, const nsGraphics::Vec2D& posi
         throw nsException::CException(filename + " cannot be loaded", nsException::KFileError);
     }
 
-    FileBegin fileBegin;
-    read(fd, &fileBegin, sizeof(FileBegin));
+    const bool loaded = loadFromFile(fd);
+    close(fd);
 
-    for (uint32_t i = 0; i < fileBegin.pixelCount; ++i)
+    if (!loaded)
     {
-        GLubyte red, green, blue, alpha;
-        read(fd, &red,    sizeof(red));
-        read(fd, &green,  sizeof(green));
-        read(fd, &blue,   sizeof(blue));
-        read(fd, &alpha,  sizeof(alpha));
-
-        m_pixelData.push_back(nsGraphics::RGBAcolor(red, green, blue, alpha));
+        std::cerr << "[DisplaySprite] Sprite file \"" << filename << "\" is not a valid .si2 file." << std::endl;
+        throw nsException::CException(filename + " cannot be loaded", nsException::KFileError);
     }
 
-    close(fd);
-
-    m_rowSize = fileBegin.rowSize;
+    // Un sprite indexé n'a que sa palette a prémultiplier
+    if (m_alphaMode == ALPHA_PREMULTIPLIED)
+        nsGraphics::premultiplyPixels(isIndexed() ? m_palette : m_pixelData);
 } // Sprite()
 
-nsGui::Sprite::Sprite(const std::vector<nsGraphics::RGBAcolor>& pixelData, const uint32_t& rowSize, const nsGraphics::Vec2D& position)
+nsGui::Sprite::Sprite(const std::vector<nsGraphics::RGBAcolor>& pixelData, const uint32_t& rowSize, const nsGraphics::Vec2D& position,
+                      const AlphaMode& alphaMode)
     : m_position(position)
     , m_rowSize(rowSize)
     , m_pixelData(pixelData)
-{} // Sprite()
+    , m_alphaMode(alphaMode)
+{
+    if (m_alphaMode == ALPHA_PREMULTIPLIED)
+        nsGraphics::premultiplyPixels(m_pixelData);
+} // Sprite()
+
+nsGui::Sprite::Sprite(const std::vector<nsGraphics::RGBAcolor>& palette, const std::vector<uint8_t>& indices, const uint32_t& rowSize,
+                      const nsGraphics::Vec2D& position, const AlphaMode& alphaMode)
+    : m_position(position)
+    , m_rowSize(rowSize)
+    , m_palette(palette)
+    , m_indices(indices)
+    , m_alphaMode(alphaMode)
+{
+    if (m_palette.empty() || m_palette.size() > KMaxPaletteSize || !areIndicesValid())
+        throw nsException::CException("Invalid sprite palette", nsException::KErrArg);
+
+    if (m_alphaMode == ALPHA_PREMULTIPLIED)
+        nsGraphics::premultiplyPixels(m_palette);
+} // Sprite()
+
+nsGui::Sprite::Sprite(const std::shared_ptr<const Sprite>& page, const nsGraphics::Rect& area, const nsGraphics::Vec2D& position)
+    : m_position(position)
+    , m_rowSize(area.computeSize().getX())
+    , m_alphaMode(ALPHA_STRAIGHT)
+    , m_page(page)
+    , m_area(area)
+{
+    if (!m_page || m_area.isEmpty()
+        || nsGraphics::Rect::fromPositionSize(nsGraphics::Vec2D(), m_page->computeSize()).computeIntersection(m_area) != m_area)
+        throw nsException::CException("Invalid sprite area", nsException::KErrArg);
+
+    // Une vue ne dépend jamais d'une autre vue : l'affichage n'a qu'une indirection a suivre
+    if (m_page->m_page)
+    {
+        m_area = m_area.translated(m_page->m_area.getMin());
+        m_page = m_page->m_page;
+    }
+
+    m_alphaMode = m_page->m_alphaMode;
+} // Sprite()
+
+nsGui::Sprite::Sprite(const void* data, const size_t& size, const std::shared_ptr<const void>& owner, const nsGraphics::Vec2D& position,
+                      const AlphaMode& alphaMode)
+    : m_position(position)
+    , m_alphaMode(alphaMode)
+    , m_memoryOwner(owner)
+{
+    if (data == nullptr || !loadFromMemory(static_cast<const uint8_t*>(data), size))
+        throw nsException::CException("Invalid .si2 data", nsException::KErrArg);
+
+    if (m_alphaMode == ALPHA_PREMULTIPLIED)
+    {
+        // La mémoire externe est en lecture seule : des pixels RGBA doivent être copiés pour être prémultipliés
+        if (!isIndexed())
+            detachStorage();
+
+        nsGraphics::premultiplyPixels(isIndexed() ? m_palette : m_pixelData);
+    }
+} // Sprite()
+
+bool nsGui::Sprite::isFileBeginValid(const FileBegin& fileBegin)
+{
+    return memcmp(&fileBegin.magic, "SI", 2) == 0 && memcmp(&fileBegin.headmagic, "HEAD", 4) == 0 && fileBegin.rowSize != 0
+        && ((fileBegin.fileVersion == FILE_VERSION_RGBA && memcmp(&fileBegin.datamagic, "DATA", 4) == 0)
+            || (fileBegin.fileVersion == FILE_VERSION_INDEXED && memcmp(&fileBegin.datamagic, "PALT", 4) == 0));
+} // isFileBeginValid()
+
+bool nsGui::Sprite::loadFromFile(const int& fd)
+{
+    FileBegin fileBegin;
+    if (!readExactly(fd, &fileBegin, sizeof(FileBegin)) || !isFileBeginValid(fileBegin))
+        return false;
+
+    m_rowSize = fileBegin.rowSize;
+
+    if (fileBegin.fileVersion == FILE_VERSION_RGBA)
+    {
+        // RGBAcolor fait exactement quatre octets R, G, B, A : les pixels se lisent d'un bloc
+        m_pixelData.resize(fileBegin.pixelCount);
+        return readExactly(fd, m_pixelData.data(), m_pixelData.size() * sizeof(nsGraphics::RGBAcolor));
+    }
+
+    uint16_t paletteSize;
+    if (!readExactly(fd, &paletteSize, sizeof(paletteSize)) || paletteSize == 0 || paletteSize > KMaxPaletteSize)
+        return false;
+
+    m_palette.resize(paletteSize);
+    if (!readExactly(fd, m_palette.data(), m_palette.size() * sizeof(nsGraphics::RGBAcolor)))
+        return false;
+
+    char dataMagic[4];
+    if (!readExactly(fd, dataMagic, sizeof(dataMagic)) || memcmp(dataMagic, "DATA", 4) != 0)
+        return false;
+
+    m_indices.resize(fileBegin.pixelCount);
+    return readExactly(fd, m_indices.data(), m_indices.size()) && areIndicesValid();
+} // loadFromFile()
+
+bool nsGui::Sprite::loadFromMemory(const uint8_t* data, const size_t& size)
+{
+    FileBegin fileBegin;
+    if (size < sizeof(FileBegin))
+        return false;
+
+    // Les champs du début ne sont pas alignés : ils sont copiés plutôt que lus en place
+    memcpy(&fileBegin, data, sizeof(FileBegin));
+    if (!isFileBeginValid(fileBegin))
+        return false;
+
+    m_rowSize = fileBegin.rowSize;
+
+    const uint8_t* cursor = data + sizeof(FileBegin);
+    const uint8_t* const end = data + size;
+
+    if (fileBegin.fileVersion == FILE_VERSION_RGBA)
+    {
+        if (size_t(end - cursor) / sizeof(nsGraphics::RGBAcolor) < fileBegin.pixelCount)
+            return false;
+
+        m_memoryPixels = reinterpret_cast<const nsGraphics::RGBAcolor*>(cursor);
+        m_memoryPixelCount = fileBegin.pixelCount;
+        return true;
+    }
+
+    uint16_t paletteSize;
+    if (size_t(end - cursor) < sizeof(paletteSize))
+        return false;
+
+    memcpy(&paletteSize, cursor, sizeof(paletteSize));
+    cursor += sizeof(paletteSize);
+
+    if (paletteSize == 0 || paletteSize > KMaxPaletteSize
+        || size_t(end - cursor) < paletteSize * sizeof(nsGraphics::RGBAcolor) + 4 + fileBegin.pixelCount)
+        return false;
+
+    // La palette est petite et peut être modifiée (voir getPalette()) : elle est copiée, pas les indices
+    const nsGraphics::RGBAcolor* palette = reinterpret_cast<const nsGraphics::RGBAcolor*>(cursor);
+    m_palette.assign(palette, palette + paletteSize);
+    cursor += paletteSize * sizeof(nsGraphics::RGBAcolor);
+
+    if (memcmp(cursor, "DATA", 4) != 0)
+        return false;
+
+    m_memoryIndices = cursor + 4;
+    m_memoryPixelCount = fileBegin.pixelCount;
+    return areIndicesValid();
+} // loadFromMemory()
+
+bool nsGui::Sprite::areIndicesValid() const
+{
+    const uint8_t* indices = getIndexPointer();
+    const size_t count = getPixelCount();
+
+    return count == 0 || *std::max_element(indices, indices + count) < m_palette.size();
+} // areIndicesValid()
+
+const nsGraphics::RGBAcolor* nsGui::Sprite::getPixelPointer() const
+{
+    return m_memoryPixels ? m_memoryPixels : m_pixelData.data();
+} // getPixelPointer()
+
+const uint8_t* nsGui::Sprite::getIndexPointer() const
+{
+    return m_memoryIndices ? m_memoryIndices : m_indices.data();
+} // getIndexPointer()
+
+void nsGui::Sprite::detachStorage()
+{
+    if (m_page)
+    {
+        const unsigned width = m_rowSize;
+        const unsigned height = m_area.computeSize().getY();
+        const nsGraphics::RGBAcolor* pixels = m_page->getPixelPointer();
+        const uint8_t* indices = m_page->getIndexPointer();
+
+        for (unsigned y = 0; y < height; ++y)
+        {
+            const size_t rowStart = size_t(m_area.getMin().getY() + y) * m_page->m_rowSize + m_area.getMin().getX();
+
+            if (m_page->isIndexed())
+                m_indices.insert(m_indices.end(), indices + rowStart, indices + rowStart + width);
+            else
+                m_pixelData.insert(m_pixelData.end(), pixels + rowStart, pixels + rowStart + width);
+        }
+
+        m_palette = m_page->m_palette;
+        m_page.reset();
+    }
+    else if (m_memoryIndices)
+        m_indices.assign(m_memoryIndices, m_memoryIndices + m_memoryPixelCount);
+    else if (m_memoryPixels)
+        m_pixelData.assign(m_memoryPixels, m_memoryPixels + m_memoryPixelCount);
+    else
+        return;
+
+    m_memoryOwner.reset();
+    m_memoryPixels = nullptr;
+    m_memoryIndices = nullptr;
+    m_memoryPixelCount = 0;
+} // detachStorage()
 
 void nsGui::Sprite::draw(MinGL& window) const
 {
-    UNUSED(window);
+    // Le mode de mélange est mis en cache par la fenêtre : un sprite non prémultiplié n'appelle jamais OpenGL pour ça
+    if (m_alphaMode == ALPHA_PREMULTIPLIED)
+        window.setBlendMode(MinGL::BLEND_PREMULTIPLIED_ALPHA);
+
+    // Une vue lit les pixels de sa page, ligne par ligne, sans les avoir copiés
+    const Sprite& source = m_page ? *m_page : *this;
+    const nsGraphics::Rect area = getArea();
+    const unsigned width = m_rowSize;
+    const unsigned height = area.computeSize().getY();
+    const nsGraphics::RGBAcolor* pixels = source.getPixelPointer();
+    const uint8_t* indices = source.getIndexPointer();
 
     glBegin(GL_POINTS);
 
-    for (unsigned i = 0; i < m_pixelData.size(); ++i)
+    for (unsigned y = 0; y < height; ++y)
     {
-        const nsGraphics::RGBAcolor actualColor = m_pixelData[i];
-        const unsigned x = i % m_rowSize;
-        const unsigned y = i / m_rowSize;
+        const size_t rowStart = size_t(area.getMin().getY() + y) * source.m_rowSize + area.getMin().getX();
 
-        glColor4ub(actualColor.getRed(), actualColor.getGreen(), actualColor.getBlue(), actualColor.getAlpha());
-        glVertex2i(x + m_position.getX(), y + m_position.getY());
+        if (source.isIndexed())
+        {
+            // Chaque pixel est décodé a travers la palette au moment de l'affichage
+            for (unsigned x = 0; x < width; ++x)
+            {
+                glColor4ubv(source.m_palette[indices[rowStart + x]].data());
+                glVertex2i(x + m_position.getX(), y + m_position.getY());
+            }
+        }
+        else
+        {
+            for (unsigned x = 0; x < width; ++x)
+            {
+                glColor4ubv(pixels[rowStart + x].data());
+                glVertex2i(x + m_position.getX(), y + m_position.getY());
+            }
+        }
     }
 
     glEnd();
+
+    // Les autres éléments comptent sur le mode par défaut
+    window.setBlendMode(MinGL::BLEND_STRAIGHT_ALPHA);
 } // draw()
 
-void nsGui::Sprite::getValues(const int &id, std::vector<float> &values)
+void nsGui::Sprite::getValues(const int &id, nsTransition::ValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_POSITION:
@@ -82,7 +334,7 @@ void nsGui::Sprite::getValues(const int &id, std::vector<float> &values)
     }
 } // getValues()
 
-void nsGui::Sprite::setValues(const int &id, const std::vector<float> &values)
+void nsGui::Sprite::setValues(const int &id, nsTransition::ConstValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_POSITION:
@@ -93,13 +345,138 @@ void nsGui::Sprite::setValues(const int &id, const std::vector<float> &values)
     }
 } // setValues()
 
+size_t nsGui::Sprite::getValueCount(const int &id) const
+{
+    return getComponentCount(id);
+} // getValueCount()
+
 const uint32_t& nsGui::Sprite::getRowSize() const
 {
     return m_rowSize;
 } // getRowSize()
 
-const std::vector<nsGraphics::RGBAcolor>& nsGui::Sprite::getPixelData() const
+bool nsGui::Sprite::isIndexed() const
+{
+    return !getPalette().empty();
+} // isIndexed()
+
+size_t nsGui::Sprite::getPixelCount() const
+{
+    if (m_page)
+        return size_t(m_rowSize) * m_area.computeSize().getY();
+
+    if (isInExternalMemory())
+        return m_memoryPixelCount;
+
+    return isIndexed() ? m_indices.size() : m_pixelData.size();
+} // getPixelCount()
+
+bool nsGui::Sprite::isView() const
+{
+    return m_page != nullptr;
+} // isView()
+
+const std::shared_ptr<const nsGui::Sprite>& nsGui::Sprite::getPage() const
+{
+    return m_page;
+} // getPage()
+
+bool nsGui::Sprite::isInExternalMemory() const
 {
+    return m_memoryPixels != nullptr || m_memoryIndices != nullptr;
+} // isInExternalMemory()
+
+nsGraphics::Rect nsGui::Sprite::getArea() const
+{
+    return m_page ? m_area : nsGraphics::Rect::fromPositionSize(nsGraphics::Vec2D(), computeSize());
+} // getArea()
+
+const std::vector<nsGraphics::RGBAcolor>& nsGui::Sprite::getPalette() const
+{
+    return m_page ? m_page->m_palette : m_palette;
+} // getPalette()
+
+std::vector<nsGraphics::RGBAcolor>& nsGui::Sprite::getPalette()
+{
+    detachStorage();
+    return m_palette;
+} // getPalette()
+
+std::vector<uint8_t> nsGui::Sprite::computeIndices() const
+{
+    // Même parcours que computePixelData()
+    const Sprite& source = m_page ? *m_page : *this;
+    if (!source.isIndexed())
+        return std::vector<uint8_t>();
+
+    const nsGraphics::Rect area = getArea();
+    const unsigned width = m_rowSize;
+    const unsigned height = area.computeSize().getY();
+    const uint8_t* indices = source.getIndexPointer();
+
+    std::vector<uint8_t> indexData;
+    indexData.reserve(size_t(width) * height);
+
+    for (unsigned y = 0; y < height; ++y)
+    {
+        const size_t rowStart = size_t(area.getMin().getY() + y) * source.m_rowSize + area.getMin().getX();
+        indexData.insert(indexData.end(), indices + rowStart, indices + rowStart + width);
+    }
+
+    return indexData;
+} // computeIndices()
+
+nsGui::Sprite::AlphaMode nsGui::Sprite::getAlphaMode() const
+{
+    return m_alphaMode;
+} // getAlphaMode()
+
+std::vector<nsGraphics::RGBAcolor> nsGui::Sprite::computePixelData() const
+{
+    // Même parcours que draw()
+    const Sprite& source = m_page ? *m_page : *this;
+    const nsGraphics::Rect area = getArea();
+    const unsigned width = m_rowSize;
+    const unsigned height = area.computeSize().getY();
+    const nsGraphics::RGBAcolor* pixels = source.getPixelPointer();
+    const uint8_t* indices = source.getIndexPointer();
+
+    std::vector<nsGraphics::RGBAcolor> pixelData;
+    pixelData.reserve(size_t(width) * height);
+
+    for (unsigned y = 0; y < height; ++y)
+    {
+        const size_t rowStart = size_t(area.getMin().getY() + y) * source.m_rowSize + area.getMin().getX();
+
+        if (source.isIndexed())
+        {
+            for (unsigned x = 0; x < width; ++x)
+                pixelData.push_back(source.m_palette[indices[rowStart + x]]);
+        }
+        else
+            pixelData.insert(pixelData.end(), pixels + rowStart, pixels + rowStart + width);
+    }
+
+    return pixelData;
+} // computePixelData()
+
+std::vector<nsGraphics::RGBAcolor>& nsGui::Sprite::getPixelData()
+{
+    detachStorage();
+
+    // Un sprite indexé n'a pas de pixels RGBA : ils sont décodés a travers la palette, qui n'est plus utilisée ensuite
+    if (!m_palette.empty())
+    {
+        m_pixelData.reserve(m_indices.size());
+        for (const uint8_t index : m_indices)
+            m_pixelData.push_back(m_palette[index]);
+
+        m_indices.clear();
+        m_indices.shrink_to_fit();
+        m_palette.clear();
+        m_palette.shrink_to_fit();
+    }
+
     return m_pixelData;
 } // getPixelData()
 
@@ -115,5 +492,10 @@ void nsGui::Sprite::setPosition(const nsGraphics::Vec2D& position)
 
 nsGraphics::Vec2D nsGui::Sprite::computeSize() const
 {
-    return nsGraphics::Vec2D(m_pixelData.size() / m_rowSize, m_rowSize);
+    return nsGraphics::Vec2D(m_rowSize, getPixelCount() / m_rowSize);
 } // computeSize()
+
+nsGraphics::Rect nsGui::Sprite::computeBounds() const
+{
+    return nsGraphics::Rect::fromPositionSize(m_position, computeSize());
+} // computeBounds()
@@ -0,0 +1,122 @@
+/**
+ *
+ * @file    sprite_atlas.cpp
+ * @date    Octobre 2026
+ * @version 1.0
+ * @brief   Page de sprites rangés dans une seule image
+ *
+ **/
+
+#include "mingl/gui/sprite_atlas.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "mingl/exception/cexception.h"
+
+nsGui::SpriteAtlas::SpriteAtlas(const std::string& indexFilename, const Sprite::AlphaMode& alphaMode)
+{
+    std::ifstream index(indexFilename);
+    if (!index)
+    {
+        std::cerr << "[SpriteAtlas] Atlas index \"" << indexFilename << "\" could not be opened." << std::endl;
+        throw nsException::CException(indexFilename + " cannot be loaded", nsException::KFileError);
+    }
+
+    m_page = std::make_shared<const Sprite>(readIndex(index, indexFilename), nsGraphics::Vec2D(), alphaMode);
+    checkAreas(indexFilename);
+} // SpriteAtlas()
+
+nsGui::SpriteAtlas::SpriteAtlas(const AssetBundle& bundle, const std::string& indexName, const Sprite::AlphaMode& alphaMode)
+{
+    const AssetBundle::Blob blob = bundle.getBlob(indexName);
+    std::istringstream index(std::string(reinterpret_cast<const char*>(blob.data), blob.size));
+
+    m_page = std::make_shared<const Sprite>(bundle.getSprite(readIndex(index, indexName), nsGraphics::Vec2D(), alphaMode));
+    checkAreas(indexName);
+} // SpriteAtlas()
+
+std::string nsGui::SpriteAtlas::readIndex(std::istream& index, const std::string& indexName)
+{
+    std::string pageFilename;
+    std::string line;
+    while (std::getline(index, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream fields(line);
+        std::string name;
+        fields >> name;
+
+        if (name == "page")
+        {
+            fields >> pageFilename;
+            continue;
+        }
+
+        int x, y, width, height;
+        if (!(fields >> x >> y >> width >> height) || width <= 0 || height <= 0)
+        {
+            std::cerr << "[SpriteAtlas] Atlas index \"" << indexName << "\" has an invalid line: \"" << line << "\"." << std::endl;
+            throw nsException::CException(indexName + " cannot be loaded", nsException::KFileError);
+        }
+
+        m_areas[name] = nsGraphics::Rect::fromPositionSize(nsGraphics::Vec2D(x, y), nsGraphics::Vec2D(width, height));
+    }
+
+    if (pageFilename.empty())
+    {
+        std::cerr << "[SpriteAtlas] Atlas index \"" << indexName << "\" does not name its page." << std::endl;
+        throw nsException::CException(indexName + " cannot be loaded", nsException::KFileError);
+    }
+
+    // La page est rangée a côté de son index
+    const std::string::size_type separator = indexName.find_last_of('/');
+    if (separator != std::string::npos)
+        pageFilename = indexName.substr(0, separator + 1) + pageFilename;
+
+    return pageFilename;
+} // readIndex()
+
+void nsGui::SpriteAtlas::checkAreas(const std::string& indexName) const
+{
+    // Vérifié une fois ici, plutôt qu'a chaque getSprite()
+    const nsGraphics::Rect pageArea = m_page->getArea();
+    for (const std::pair<const std::string, nsGraphics::Rect>& area : m_areas)
+        if (pageArea.computeIntersection(area.second) != area.second)
+        {
+            std::cerr << "[SpriteAtlas] Image \"" << area.first << "\" lies outside of the page of atlas \"" << indexName << "\"." << std::endl;
+            throw nsException::CException(indexName + " cannot be loaded", nsException::KFileError);
+        }
+} // checkAreas()
+
+bool nsGui::SpriteAtlas::contains(const std::string& name) const
+{
+    return m_areas.find(name) != m_areas.end();
+} // contains()
+
+nsGraphics::Rect nsGui::SpriteAtlas::getArea(const std::string& name) const
+{
+    const std::map<std::string, nsGraphics::Rect>::const_iterator area = m_areas.find(name);
+    if (area == m_areas.end())
+        throw nsException::CException("No image named " + name + " in atlas", nsException::KErrArg);
+
+    return area->second;
+} // getArea()
+
+nsGui::Sprite nsGui::SpriteAtlas::getSprite(const std::string& name, const nsGraphics::Vec2D& position) const
+{
+    return Sprite(m_page, getArea(name), position);
+} // getSprite()
+
+const std::shared_ptr<const nsGui::Sprite>& nsGui::SpriteAtlas::getPage() const
+{
+    return m_page;
+} // getPage()
+
+const std::map<std::string, nsGraphics::Rect>& nsGui::SpriteAtlas::getAreas() const
+{
+    return m_areas;
+} // getAreas()
@@ -24,7 +24,7 @@ nsGui::Text::Text(const nsGraphics::Vec2D &position, const std::string &content,
     , m_verticalAlignment(verticalAlignment)
 {} // Text()
 
-void nsGui::Text::getValues(const int &id, std::vector<float> &values)
+void nsGui::Text::getValues(const int &id, nsTransition::ValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_COLOR_RGB:
@@ -47,7 +47,7 @@ void nsGui::Text::getValues(const int &id, std::vector<float> &values)
     }
 } // getValues()
 
-void nsGui::Text::setValues(const int &id, const std::vector<float> &values)
+void nsGui::Text::setValues(const int &id, nsTransition::ConstValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_COLOR_RGB:
@@ -70,6 +70,11 @@ void nsGui::Text::setValues(const int &id, const std::vector<float> &values)
     }
 } // setValues()
 
+size_t nsGui::Text::getValueCount(const int &id) const
+{
+    return getComponentCount(id);
+} // getValueCount()
+
 int nsGui::Text::computeWidth() const
 {
     return glutBitmapLength(m_textFont.convertForGlut(), reinterpret_cast<const unsigned char *>(m_content.c_str()));
@@ -8,14 +8,100 @@
  *
  **/
 
-#include <map>
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 #include "mingl/mingl.h"
 
+#if defined(__unix__) && !defined(__APPLE__)
+#include <poll.h>
+#include <GL/glx.h>
+#define MINGL_POLL_X_CONNECTION
+#endif
+
 // Astuce pour faire passer les handlers en fonction static dans initGraphic()
 namespace {
 
-std::map<int, MinGL *> anyWindow;
+// Table de dispatch, indexée directement par l'identifiant de fenêtre freeglut
+std::vector<MinGL *> anyWindow;
+
+// Nombre de fenêtres enregistrées, et la fenêtre elle-même quand elle est seule (cas le plus courant)
+size_t windowCount = 0;
+MinGL *singleWindow = nullptr;
+
+void registerWindow(int id, MinGL *window)
+{
+    if (id <= 0) return;
+
+    if (static_cast<size_t>(id) >= anyWindow.size())
+        anyWindow.resize(id + 1, nullptr);
+
+    if (anyWindow[id] == nullptr)
+        ++windowCount;
+
+    anyWindow[id] = window;
+    singleWindow = (windowCount == 1) ? window : nullptr;
+} // registerWindow()
+
+void unregisterWindow(int id, MinGL *window)
+{
+    // freeglut peut réutiliser un identifiant : on ne retire que notre propre entrée
+    if (id <= 0 || static_cast<size_t>(id) >= anyWindow.size() || anyWindow[id] != window) return;
+
+    anyWindow[id] = nullptr;
+    --windowCount;
+
+    // On retrouve la fenêtre restante pour réactiver le chemin rapide
+    singleWindow = nullptr;
+    if (windowCount == 1)
+    {
+        for (MinGL *remaining : anyWindow)
+        {
+            if (remaining != nullptr)
+            {
+                singleWindow = remaining;
+                break;
+            }
+        }
+    }
+} // unregisterWindow()
+
+inline MinGL *findWindow()
+{
+    // Une seule fenêtre : freeglut ne peut appeler les handlers que pour elle
+    if (singleWindow != nullptr) return singleWindow;
+
+    const size_t current_id = glutGetWindow();
+    return current_id < anyWindow.size() ? anyWindow[current_id] : nullptr;
+} // findWindow()
+
+// Attend que des évènements arrivent sur la connexion au serveur X, au plus timeout
+void waitForWindowEvents(const std::chrono::steady_clock::duration& timeout)
+{
+#ifdef MINGL_POLL_X_CONNECTION
+    Display *display = glXGetCurrentDisplay();
+    if (display != nullptr)
+    {
+        // Arrondi a la milliseconde supérieure, pour ne pas se réveiller juste avant la fin du délai
+        const std::chrono::milliseconds timeoutMs = std::chrono::ceil<std::chrono::milliseconds>(timeout);
+        pollfd connection = {ConnectionNumber(display), POLLIN, 0};
+        poll(&connection, 1, static_cast<int>(timeoutMs.count()));
+        return;
+    }
+#endif
+
+    // Sans connexion X (macOS, Windows, Wayland...), les évènements sont relevés toutes les 10 ms
+    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(std::chrono::milliseconds(10), timeout));
+} // waitForWindowEvents()
+
+void applyBlendMode(const MinGL::BlendMode& blendMode)
+{
+    if (blendMode == MinGL::BLEND_PREMULTIPLIED_ALPHA)
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    else
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+} // applyBlendMode()
 
 template<typename T, T oHandler>
 struct callBackBuilder;
@@ -25,12 +111,10 @@ struct callBackBuilder<void(Obj::*)(Arg...), oHandler>
 {
     static void callback(Arg... arg)
     {
-        int current_id = glutGetWindow();
-        //cout << "window [" << current_id << "] handler call" << endl;
-        auto it = anyWindow.find(current_id);
-        if (it != anyWindow.end())
+        MinGL *window = findWindow();
+        if (window != nullptr)
         {
-            (it->second->*oHandler)(arg...);
+            (window->*oHandler)(arg...);
         }
     }
 };
@@ -43,6 +127,8 @@ MinGL::MinGL(const std::string& name, const nsGraphics::Vec2D& windowSize, const
              const nsGraphics::RGBAcolor& backgroundColor)
     : m_windowName(name)
     , m_bgColor(backgroundColor)
+    , m_windowSize(windowSize)
+    , m_windowPosition(windowPosition)
     , m_eventManager()
     , m_windowIsOpen(false)
 {
@@ -52,19 +138,43 @@ MinGL::MinGL(const std::string& name, const nsGraphics::Vec2D& windowSize, const
 
 MinGL::~MinGL()
 {
-    auto it = anyWindow.find(m_glutWindowId);
-    if (it != anyWindow.end())
-        anyWindow.erase(it);
-
     stopGraphic();
 } //~MinGL()
 
 void MinGL::finishFrame()
 {
+    m_frameReady = true;
+    m_redrawRequested = false;
+
     glutPostRedisplay();
     glutMainLoopEvent();
 } // finishFrame()
 
+bool MinGL::waitEvents(const std::chrono::milliseconds& timeout)
+{
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+    const unsigned long long startActivity = m_activityCount;
+
+    while (true)
+    {
+        glutMainLoopEvent();
+        if (m_activityCount != startActivity || !m_windowIsOpen)
+            return true;
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+            return false;
+
+        // glutMainLoopEvent() a vidé la file de Xlib : la connexion ne redevient lisible qu'a l'évènement suivant
+        waitForWindowEvents(deadline - now);
+    }
+} // waitEvents()
+
+bool MinGL::needsRedraw() const
+{
+    return m_redrawRequested;
+} // needsRedraw()
+
 void MinGL::clearScreen()
 {
     glClear(GL_COLOR_BUFFER_BIT);
@@ -86,22 +196,44 @@ void MinGL::setBackgroundColor(const nsGraphics::RGBAcolor& backgroundColor)
     glClearColor(m_bgColor.getRed() / 256.f, m_bgColor.getGreen() / 256.f, m_bgColor.getBlue() / 256.f, m_bgColor.getAlpha() / 256.f);
 } // setBackgroundColor()
 
+MinGL::BlendMode MinGL::getBlendMode() const
+{
+    return m_blendMode;
+} // getBlendMode()
+
+void MinGL::setBlendMode(const BlendMode& blendMode)
+{
+    if (blendMode == m_blendMode)
+        return;
+
+    m_blendMode = blendMode;
+
+    // Sans fenêtre, pas de contexte OpenGL : le mode sera appliqué par initGraphic()
+    if (m_glutWindowId != 0)
+        applyBlendMode(m_blendMode);
+} // setBlendMode()
+
 void MinGL::initGraphic()
 {
     // Initialisation GLUT
     glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA);
 
     m_glutWindowId = glutCreateWindow(m_windowName.c_str());
-    anyWindow[m_glutWindowId] = this;
+    registerWindow(m_glutWindowId, this);
+
+    // Le gestionnaire de fenêtres a pu ajuster la géométrie demandée
+    m_windowSize = nsGraphics::Vec2D(glutGet(GLUT_WINDOW_WIDTH), glutGet(GLUT_WINDOW_HEIGHT));
+    m_windowPosition = nsGraphics::Vec2D(glutGet(GLUT_WINDOW_X), glutGet(GLUT_WINDOW_Y));
 
     // On active la transparence
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    applyBlendMode(m_blendMode);
 
     glutSetOption(GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_CONTINUE_EXECUTION);
 
     // Initialisation handlers
     glutReshapeFunc(BIND_CALLBACK(&MinGL::callReshape));
+    glutPositionFunc(BIND_CALLBACK(&MinGL::callPosition));
     glutDisplayFunc(BIND_CALLBACK(&MinGL::callDisplay));
     glutMouseFunc(BIND_CALLBACK(&MinGL::callMouse));
     glutMotionFunc(BIND_CALLBACK(&MinGL::callMotion));
@@ -126,8 +258,15 @@ void MinGL::initGraphic()
 
 void MinGL::stopGraphic()
 {
+    // La fenêtre a peut-être déjà été détruite
+    if (m_glutWindowId == 0) return;
+
     glutDestroyWindow(m_glutWindowId);
     glutMainLoopEvent();
+
+    // On se retire de la table seulement après que freeglut a appelé callClose()
+    unregisterWindow(m_glutWindowId, this);
+    m_glutWindowId = 0;
 } // stopGraphic()
 
 bool MinGL::isPressed(const KeyType_t &key)
@@ -140,21 +279,47 @@ void MinGL::resetKey(const KeyType_t &key)
     m_keyboardMap[key] = false;
 } // resetKey()
 
-void MinGL::callReshape(int h, int w)
+void MinGL::callReshape(int width, int height)
 {
+    m_windowSize = nsGraphics::Vec2D(width, height);
+
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
 
-    nsGraphics::Vec2D windowSize = getWindowSize();
-    gluOrtho2D(0.0, GLfloat (windowSize.getX()), GLfloat (windowSize.getY()), 0.0);
+    gluOrtho2D(0.0, GLfloat (width), GLfloat (height), 0.0);
 
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
-    glViewport(0, 0, h, w);
+    glViewport(0, 0, width, height);
+
+    m_redrawRequested = true;
+    ++m_activityCount;
+
+    // On prévient l'utilisateur, qui n'a ainsi pas besoin de surveiller la taille a chaque image
+    nsEvent::Event_t event;
+    event.eventType = nsEvent::EventType_t::WindowResize;
+    event.eventData.resizeData.width = width;
+    event.eventData.resizeData.height = height;
+
+    m_eventManager.pushEvent(event);
 } // callReshape()
 
+void MinGL::callPosition(int x, int y)
+{
+    m_windowPosition = nsGraphics::Vec2D(x, y);
+} // callPosition()
+
 void MinGL::callDisplay()
 {
+    // Réaffichage demandé par le système sans frame prête : le back buffer n'est plus fiable, il faut redessiner
+    if (!m_frameReady)
+    {
+        m_redrawRequested = true;
+        ++m_activityCount;
+        return;
+    }
+
+    m_frameReady = false;
     glFlush();
     glutSwapBuffers();
 } // callDisplay()
@@ -169,6 +334,7 @@ void MinGL::callMouse(int button, int state, int x, int y)
     event.eventData.clickData.y = y;
 
     m_eventManager.pushEvent(event);
+    ++m_activityCount;
 } // calMouse()
 
 void MinGL::callMotion(int x, int y)
@@ -179,6 +345,7 @@ void MinGL::callMotion(int x, int y)
     event.eventData.moveData.y = y;
 
     m_eventManager.pushEvent(event);
+    ++m_activityCount;
 } // callMotion()
 
 void MinGL::callPassiveMotion(int x, int y)
@@ -189,6 +356,7 @@ void MinGL::callPassiveMotion(int x, int y)
     event.eventData.moveData.y = y;
 
     m_eventManager.pushEvent(event);
+    ++m_activityCount;
 } // callPassiveMotion()
 
 void MinGL::callKeyboard(unsigned char k, int x, int y)
@@ -196,6 +364,7 @@ void MinGL::callKeyboard(unsigned char k, int x, int y)
     (void)(x); (void)(y);
     KeyType_t key(k, false);
     m_keyboardMap[key] = true;
+    ++m_activityCount;
 } // callKeyboard()
 
 void MinGL::callKeyboardUp(unsigned char k, int x, int y)
@@ -203,6 +372,7 @@ void MinGL::callKeyboardUp(unsigned char k, int x, int y)
     (void)(x); (void)(y);
     KeyType_t key(k, false);
     m_keyboardMap[key] = false;
+    ++m_activityCount;
 } // callKeyboardUp()
 
 void MinGL::callKeyboardSpecial(int k, int x, int y)
@@ -210,6 +380,7 @@ void MinGL::callKeyboardSpecial(int k, int x, int y)
     (void)(x); (void)(y);
     KeyType_t key(k, true);
     m_keyboardMap[key] = true;
+    ++m_activityCount;
 } // callKeyboardSpecial()
 
 void MinGL::callKeyboardUpSpecial(int k, int x, int y)
@@ -217,30 +388,36 @@ void MinGL::callKeyboardUpSpecial(int k, int x, int y)
     (void)(x); (void)(y);
     KeyType_t key(k, true);
     m_keyboardMap[key] = false;
+    ++m_activityCount;
 } // callKeyboardUpSpecial()
 
 void MinGL::callClose()
 {
     m_windowIsOpen = false;
+    ++m_activityCount;
 } // callClose()
 
 nsGraphics::Vec2D MinGL::getWindowSize() const
 {
-    return nsGraphics::Vec2D(glutGet(GLUT_WINDOW_WIDTH), glutGet(GLUT_WINDOW_HEIGHT));
+    return m_windowSize;
 } // getWindowSize()
 
 void MinGL::setWindowSize(const nsGraphics::Vec2D &windowSize)
 {
+    // La taille réelle sera confirmée par callReshape()
+    m_windowSize = windowSize;
     glutReshapeWindow(windowSize.getX(), windowSize.getY());
 } // setWindowSize()
 
 nsGraphics::Vec2D MinGL::getWindowPosition() const
 {
-    return nsGraphics::Vec2D(glutGet(GLUT_WINDOW_X), glutGet(GLUT_WINDOW_Y));
+    return m_windowPosition;
 } // getWindowPosition()
 
 void MinGL::setWindowPosition(const nsGraphics::Vec2D &windowPosition)
 {
+    // La position réelle sera confirmée par callPosition()
+    m_windowPosition = windowPosition;
     glutPositionWindow(windowPosition.getX(), windowPosition.getY());
 } // setWindowPosition()
 
@@ -62,7 +62,7 @@ void nsShape::Circle::draw(MinGL& window) const
     }
 } // draw()
 
-void nsShape::Circle::getValues(const int &id, std::vector<float> &values)
+void nsShape::Circle::getValues(const int &id, nsTransition::ValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -102,7 +102,7 @@ void nsShape::Circle::getValues(const int &id, std::vector<float> &values)
     }
 } // getValues()
 
-void nsShape::Circle::setValues(const int &id, const std::vector<float> &values)
+void nsShape::Circle::setValues(const int &id, nsTransition::ConstValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -142,6 +142,11 @@ void nsShape::Circle::setValues(const int &id, const std::vector<float> &values)
     }
 } // setValues()
 
+size_t nsShape::Circle::getValueCount(const int &id) const
+{
+    return getComponentCount(id);
+} // getValueCount()
+
 nsShape::Circle nsShape::Circle::operator+(const nsGraphics::Vec2D& position) const
 {
     return Circle(m_position + position, m_radius, getFillColor(), getBorderColor());
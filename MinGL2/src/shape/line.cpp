@@ -38,7 +38,7 @@ void nsShape::Line::draw(MinGL& window) const
     glEnd();
 } // draw()
 
-void nsShape::Line::getValues(const int &id, std::vector<float> &values)
+void nsShape::Line::getValues(const int &id, nsTransition::ValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -84,7 +84,7 @@ void nsShape::Line::getValues(const int &id, std::vector<float> &values)
     }
 } // getValues()
 
-void nsShape::Line::setValues(const int &id, const std::vector<float> &values)
+void nsShape::Line::setValues(const int &id, nsTransition::ConstValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -130,6 +130,11 @@ void nsShape::Line::setValues(const int &id, const std::vector<float> &values)
     }
 } // setValues()
 
+size_t nsShape::Line::getValueCount(const int &id) const
+{
+    return getComponentCount(id);
+} // getValueCount()
+
 nsShape::Line nsShape::Line::operator+(const nsGraphics::Vec2D& position) const
 {
     return Line(m_firstPosition + position, m_secondPosition + position, getFillColor());
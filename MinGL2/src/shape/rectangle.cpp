@@ -49,7 +49,7 @@ void nsShape::Rectangle::draw(MinGL& window) const
     }
 } // draw()
 
-void nsShape::Rectangle::getValues(const int &id, std::vector<float> &values)
+void nsShape::Rectangle::getValues(const int &id, nsTransition::ValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -90,7 +90,7 @@ void nsShape::Rectangle::getValues(const int &id, std::vector<float> &values)
     }
 } // getValues()
 
-void nsShape::Rectangle::setValues(const int &id, const std::vector<float> &values)
+void nsShape::Rectangle::setValues(const int &id, nsTransition::ConstValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -131,6 +131,11 @@ void nsShape::Rectangle::setValues(const int &id, const std::vector<float> &valu
     }
 } // setValues()
 
+size_t nsShape::Rectangle::getValueCount(const int &id) const
+{
+    return getComponentCount(id);
+} // getValueCount()
+
 nsShape::Rectangle nsShape::Rectangle::operator+(const nsGraphics::Vec2D& position) const
 {
     return Rectangle(m_firstPosition + position, m_secondPosition + position, getFillColor(), getBorderColor());
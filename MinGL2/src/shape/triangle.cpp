@@ -51,7 +51,7 @@ void nsShape::Triangle::draw(MinGL& window) const
     }
 } // draw()
 
-void nsShape::Triangle::getValues(const int &id, std::vector<float> &values)
+void nsShape::Triangle::getValues(const int &id, nsTransition::ValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -98,7 +98,7 @@ void nsShape::Triangle::getValues(const int &id, std::vector<float> &values)
     }
 } // getValues()
 
-void nsShape::Triangle::setValues(const int &id, const std::vector<float> &values)
+void nsShape::Triangle::setValues(const int &id, nsTransition::ConstValueSpan_t values)
 {
     switch (id) {
         case TRANSITION_FILL_COLOR_RGB:
@@ -145,6 +145,11 @@ void nsShape::Triangle::setValues(const int &id, const std::vector<float> &value
     }
 } // setValues()
 
+size_t nsShape::Triangle::getValueCount(const int &id) const
+{
+    return getComponentCount(id);
+} // getValueCount()
+
 nsShape::Triangle nsShape::Triangle::operator+(const nsGraphics::Vec2D& position) const
 {
     return Triangle(m_firstPosition + position, m_secondPosition + position, m_thirdPosition + position, getFillColor(), getBorderColor());
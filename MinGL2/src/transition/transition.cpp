@@ -22,21 +22,21 @@ TRANSITION::Transition(const TransitionContract &contract)
     , m_finished(false)
 {} // Transition()
 
-const nsTransition::SystemDuration_t& TRANSITION::getElapsed() const
+void TRANSITION::setElapsed(const nsTransition::SystemDuration_t &elapsed)
 {
-    return m_elapsed;
-} // getElapsed()
+    setElapsed(elapsed, std::chrono::steady_clock::now());
+} // setElapsed()
 
-void TRANSITION::setElapsed(const nsTransition::SystemDuration_t &elapsed)
+void TRANSITION::setElapsed(const nsTransition::SystemDuration_t &elapsed, const nsTransition::SystemTimePoint_t &now)
 {
     // Don't allow to set the elapsed time if the start time is ahead of clock
-    if (std::chrono::steady_clock::now() < m_startTime) return;
+    if (now < m_startTime) return;
 
     // Set the new elapsed time
     m_elapsed = elapsed;
 
     // Update the target values
-    updateValues();
+    updateValues(now);
 } // setElapsed()
 
 void TRANSITION::addToElapsed(const nsTransition::SystemDuration_t &addedTime)
@@ -44,10 +44,10 @@ void TRANSITION::addToElapsed(const nsTransition::SystemDuration_t &addedTime)
     setElapsed(getElapsed() + addedTime);
 } // addToElapsed()
 
-const bool &TRANSITION::isReversed() const
+void TRANSITION::addToElapsed(const nsTransition::SystemDuration_t &addedTime, const nsTransition::SystemTimePoint_t &now)
 {
-    return m_reverse;
-} // isReversed()
+    setElapsed(getElapsed() + addedTime, now);
+} // addToElapsed()
 
 void TRANSITION::finish(const TransitionFinishModes &finishMode)
 {
@@ -56,11 +56,11 @@ void TRANSITION::finish(const TransitionFinishModes &finishMode)
     switch (finishMode)
     {
         case TRANSITION::TransitionFinishModes::FINISH_START:
-            m_target.setValues(m_id, m_beginning);
+            m_target->setValues(m_id, m_beginning);
 
             break;
         case TRANSITION::TransitionFinishModes::FINISH_DESTINATION:
-            m_target.setValues(m_id, m_destination);
+            m_target->setValues(m_id, m_destination);
 
             break;
         default:
@@ -68,12 +68,7 @@ void TRANSITION::finish(const TransitionFinishModes &finishMode)
     }
 } // finish()
 
-const bool& TRANSITION::isFinished() const
-{
-    return m_finished;
-} // isFinished()
-
-void TRANSITION::updateValues()
+void TRANSITION::updateValues(const nsTransition::SystemTimePoint_t &now)
 {
     // Prevent further progress if this transition is marked finished
     if (m_finished)
@@ -86,24 +81,31 @@ void TRANSITION::updateValues()
     // If we are in reverse mode, reverse the progress
     float effectiveElapsedProgress = (!m_reverse) ? elapsedProgress : 1 - elapsedProgress;
 
+    // Apply the easing curve
+    if (m_easing == EASING_CUBIC_BEZIER)
+        effectiveElapsedProgress = m_cubicBezier.apply(effectiveElapsedProgress);
+    else if (m_easing != EASING_LINEAR)
+        effectiveElapsedProgress = ease(m_easing, effectiveElapsedProgress);
+
     // Compute the new values
-    std::vector<float> updatedValues(m_beginning.size());
+    TransitionValues updatedValues;
+    updatedValues.resize(m_beginning.size());
     for (size_t i = 0; i < m_beginning.size(); ++i)
     {
         updatedValues[i] = ((m_destination[i] - m_beginning[i]) * effectiveElapsedProgress) + m_beginning[i];
     }
 
     // Set the new values to the target
-    m_target.setValues(m_id, updatedValues);
+    m_target->setValues(m_id, updatedValues);
 
     // Transition has finished, call the endlife handler
     if (elapsedProgress == 1.f)
     {
-        handleEndlife();
+        handleEndlife(now);
     }
 } // updateValues()
 
-void TRANSITION::handleEndlife()
+void TRANSITION::handleEndlife(const nsTransition::SystemTimePoint_t &now)
 {
     switch (m_transitionMode)
     {
@@ -118,7 +120,7 @@ void TRANSITION::handleEndlife()
             {
                 m_reverse = true;
 
-                m_startTime = std::chrono::steady_clock::now();
+                m_startTime = now;
                 m_elapsed = SystemDuration_t::zero();
             }
             else
@@ -129,9 +131,9 @@ void TRANSITION::handleEndlife()
             break;
         case TransitionContract::TransitionMode::MODE_LOOP:
             // In loop mode, the target is set to its beginning values before going again
-            m_target.setValues(m_id, m_beginning);
+            m_target->setValues(m_id, m_beginning);
 
-            m_startTime = std::chrono::steady_clock::now();
+            m_startTime = now;
             m_elapsed = SystemDuration_t::zero();
 
             break;
@@ -139,7 +141,7 @@ void TRANSITION::handleEndlife()
             // In loop smooth mode, we invert the reverse boolean before going again
             m_reverse = !m_reverse;
 
-            m_startTime = std::chrono::steady_clock::now();
+            m_startTime = now;
             m_elapsed = SystemDuration_t::zero();
 
             break;
@@ -16,37 +16,41 @@ TRANSITIONCONTRACT::TransitionContract(ITransitionable& target, const int &id,
                                        const SystemDuration_t &duration, const std::vector<float> &destination,
                                        const SystemDuration_t &delay,
                                        const TransitionMode &transitionMode)
+    : TransitionContract(target, id, duration, ConstValueSpan_t(destination), delay, transitionMode)
+{} // TransitionContract()
+
+TRANSITIONCONTRACT::TransitionContract(ITransitionable& target, const int &id,
+                                       const SystemDuration_t &duration, std::initializer_list<float> destination,
+                                       const SystemDuration_t &delay,
+                                       const TransitionMode &transitionMode)
+    : TransitionContract(target, id, duration, ConstValueSpan_t(destination.begin(), destination.size()), delay, transitionMode)
+{} // TransitionContract()
+
+TRANSITIONCONTRACT::TransitionContract(ITransitionable& target, const int &id,
+                                       const SystemDuration_t &duration, ConstValueSpan_t destination,
+                                       const SystemDuration_t &delay,
+                                       const TransitionMode &transitionMode)
     : m_id(id)
-    , m_target(target)
+    , m_target(&target)
     , m_transitionMode(transitionMode)
     , m_destination(destination)
     , m_duration(duration)
     , m_delay(delay)
+    , m_easing(EASING_LINEAR)
 {
-    m_beginning.resize(destination.size());
-    target.getValues(id, m_beginning);
-} // TransitionContract()
+    const size_t valueCount = target.getValueCount(id);
+    if (valueCount != 0 && valueCount != m_destination.size())
+        throw nsException::CException("wrong number of transition values", nsException::KErrArg);
 
-const int& TRANSITIONCONTRACT::getId() const
-{
-    return m_id;
-} // getId()
+    m_beginning.resize(m_destination.size());
+    target.getValues(id, ValueSpan_t(m_beginning));
+} // TransitionContract()
 
 const TRANSITIONCONTRACT::TransitionMode& TRANSITIONCONTRACT::getTransitionMode() const
 {
     return m_transitionMode;
 } // getTransitionMode()
 
-const std::vector<float>& TRANSITIONCONTRACT::getBeginning() const
-{
-    return m_beginning;
-} // getBeginning()
-
-const std::vector<float>& TRANSITIONCONTRACT::getDestination() const
-{
-    return m_destination;
-} // getDestination()
-
 const nsTransition::SystemDuration_t &TRANSITIONCONTRACT::getDuration() const
 {
     return m_duration;
@@ -57,9 +61,15 @@ void TRANSITIONCONTRACT::setDestinationCallback(const std::function<void ()> &ca
     m_destinationCallback = callback;
 } // setFinishCallback()
 
-const nsTransition::ITransitionable& TRANSITIONCONTRACT::getTarget() const
+void TRANSITIONCONTRACT::setEasing(const Easing &easing)
+{
+    m_easing = easing;
+} // setEasing()
+
+void TRANSITIONCONTRACT::setCubicBezier(const CubicBezier &cubicBezier)
 {
-    return m_target;
-} // getTarget()
+    m_easing = EASING_CUBIC_BEZIER;
+    m_cubicBezier = cubicBezier;
+} // setCubicBezier()
 
 #undef TRANSITIONCONTRACT
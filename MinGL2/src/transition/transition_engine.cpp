@@ -10,32 +10,64 @@
 
 #include "mingl/transition/transition_engine.h"
 
+#include <utility>
+
 #define TRANSITIONENGINE nsTransition::TransitionEngine
 
 void TRANSITIONENGINE::update(const std::chrono::microseconds &delta)
 {
+    // Read the clock once for the whole batch
+    const SystemTimePoint_t now = std::chrono::steady_clock::now();
+
+    // Callbacks may start new contracts: they are queued so the list is not reallocated under our feet
+    m_updating = true;
+
     // Update every transitioned items
-    TransitionVector_t::iterator iter = m_transitionList.begin();
-    while (iter != m_transitionList.end())
+    size_t i = 0;
+    while (i < m_transitionList.size())
     {
-        // Check if the item is finished, and remove it from the list in that case
-        if (iter->isFinished())
+        // Check if the item is finished, and remove it from the list in that case by moving the last one in its place
+        if (m_transitionList[i].isFinished())
         {
-            m_transitionList.erase(iter++);
+            if (i + 1 != m_transitionList.size())
+                m_transitionList[i] = std::move(m_transitionList.back());
+
+            m_transitionList.pop_back();
         }
         else
         {
-            iter->addToElapsed(delta);
-            ++iter;
+            m_transitionList[i].addToElapsed(delta, now);
+            ++i;
         }
     }
+
+    m_updating = false;
+
+    // Add the contracts started during this update
+    for (Transition &transition : m_pendingList)
+        m_transitionList.push_back(std::move(transition));
+
+    m_pendingList.clear();
 } // update()
 
 void TRANSITIONENGINE::startContract(const TransitionContract &contract)
 {
-    m_transitionList.push_back(Transition(contract));
+    if (m_updating)
+        m_pendingList.emplace_back(contract);
+    else
+        m_transitionList.emplace_back(contract);
 } // startContract()
 
+void TRANSITIONENGINE::reserve(const size_t &count)
+{
+    m_transitionList.reserve(count);
+} // reserve()
+
+size_t TRANSITIONENGINE::getTransitionCount() const
+{
+    return m_transitionList.size() + m_pendingList.size();
+} // getTransitionCount()
+
 void TRANSITIONENGINE::finishEveryTransition(const Transition::TransitionFinishModes &finishMode)
 {
     // Mark every transition as finished
@@ -43,6 +75,11 @@ void TRANSITIONENGINE::finishEveryTransition(const Transition::TransitionFinishM
     {
         transition.finish(finishMode);
     }
+
+    for (Transition &transition : m_pendingList)
+    {
+        transition.finish(finishMode);
+    }
 } // finishEveryTransition()
 
 void TRANSITIONENGINE::finishEveryTransitionOfTarget(const ITransitionable &transitionable, const Transition::TransitionFinishModes &finishMode)
@@ -55,6 +92,14 @@ void TRANSITIONENGINE::finishEveryTransitionOfTarget(const ITransitionable &tran
             transition.finish(finishMode);
         }
     }
+
+    for (Transition &transition : m_pendingList)
+    {
+        if (&(transition.getTarget()) == &transitionable)
+        {
+            transition.finish(finishMode);
+        }
+    }
 }  // finishEveryTransitionOfTarget()
 
 #undef TRANSITIONENGINE
@@ -1,127 +1,212 @@
-#!/usr/bin/env python3
-from array import array
-from PIL import Image
-import argparse
-import io
-import os
-
-
-__author__ = "Kuruyia"
-__version__ = "1.0.0"
-__license__ = "MIT"
-
-# The "Simple Image for Space Invaders" (.si2) file format specifications
-# Authors: Alexandre "Kuruyia" SOLLIER, Marc AMBAUD (2019 - 2020)
-#
-# | Address | Length | Description                         |
-# |---------|--------|-------------------------------------|
-# | 0x00    | 2      | Magic number ("SI")                 |
-# | 0x02    | 4      | Header magic number ("HEAD")        |
-# | 0x06    | 2      | File version                        |
-# | 0x08    | 4      | Pixel count                         |
-# | 0x0C    | 4      | Image width                         |
-# | 0x10    | 4      | Data magic number ("DATA")          |
-# | 0x14    | ???    | Uncompressed image data as RGBA8888 |
-# "File version", "Pixel count" and "Image width" entries are little-endian, unsigned numbers.
-
-
-def is_file_si2(filePath):
-    # Check the magic number
-    with open(filePath, 'rb') as file:
-        return file.read(2) == b'SI'
-
-
-def convert_from_si2(source, output):
-    # Print summary
-    print('Source image: .si2')
-    _, outExtension = os.path.splitext(output)
-    print('Output image: {}'.format(outExtension))
-
-    # Read si2 image data
-    with open(source, 'rb') as file:
-        file.seek(0x08)
-        pixelCount = int.from_bytes(file.read(4), byteorder='little', signed=False)
-        lineSize = int.from_bytes(file.read(4), byteorder='little', signed=False)
-        imageSize = (lineSize, int(pixelCount/lineSize))
-        file.seek(0x14)
-        imageData = file.read()
-
-    # Print summary 2: Electric Boogaloo
-    print('Image size is {}x{}'.format(imageSize[0], imageSize[1]))
-    print()
-    print('Starting conversion...')
-
-    # Save the converted image
-    img = Image.frombytes('RGBA', imageSize, imageData)
-    img.save(output)
-
-
-def convert_to_si2(source, output):
-    # Print summary
-    _, outExtension = os.path.splitext(source)
-    print('Source image: {}'.format(outExtension))
-    print('Output image: .si2')
-
-    # Read source image
-    with Image.open(source) as img:
-        imageSize = img.size
-
-        if img.mode != 'RGBA':
-            # Convert image mode if unsupported
-            print('Source image mode "{}" is unsupported, attempting conversion...'.format(img.mode))
-
-            imgConvt = img.convert('RGBA')
-            imageData = imgConvt.load()
-        else:
-            imageData = img.load()
-
-    # Print summary 2: Electric Boogaloo
-    print('Image size is {}x{}'.format(imageSize[0], imageSize[1]))
-    print()
-    print('Starting conversion...')
-
-    # Convert the image
-    with open(output, 'wb') as file:
-        file.write(b'SIHEAD\01\00')
-        file.write((imageSize[0]*imageSize[1]).to_bytes(4, byteorder='little'))
-        file.write((imageSize[0]).to_bytes(4, byteorder='little'))
-        file.write(b'DATA')
-
-        for y in range(0, imageSize[1]):
-            for x in range(0, imageSize[0]):
-                file.write(bytes(imageData[x, y]))
-
-
-def main():
-    # Setup argument parser
-    parser = argparse.ArgumentParser(description='This tool converts images compatible with PIL to the minGL 2 Simple Image format (.si2), and vice versa.')
-    parser.add_argument('-v', '--version', action='version', version='%(prog)s 1.0')
-    parser.add_argument('<source image file>', help='The path to the image to convert. A .si2 will be converted to a .png file. Any other image type will be converted to a .si2 file.')
-    parser.add_argument('<output file>', help='The path to output the converted image to.')
-
-    args = vars(parser.parse_args())
-    source = args['<source image file>']
-    output = args['<output file>']
-
-    # Check that source file exists
-    if not os.path.isfile(source):
-        exit('"{}"\nThe specified path does not exist.'.format(source))
-
-    # Check if source file is in the .si2 format
-    isSourceSi2 = is_file_si2(source)
-
-    if isSourceSi2:
-        convert_from_si2(source, output)
-    else:
-        convert_to_si2(source, output)
-
-    print('Done!')
-
-    # with Image.open(source) as img:
-    #     for y in range(0, img.height):
-    #         for x in range(0, img.width):
-    #             print(img.getpixel((x, y)))
-
-
-if __name__ == "__main__":
+#!/usr/bin/env python3
+from array import array
+import argparse
+import io
+import os
+
+# Pillow is only needed to read or write other image formats: .si2 to .si2 conversions work without it
+try:
+    from PIL import Image
+except ImportError:
+    Image = None
+
+
+__author__ = "Kuruyia"
+__version__ = "1.1.0"
+__license__ = "MIT"
+
+# The "Simple Image for Space Invaders" (.si2) file format specifications
+# Authors: Alexandre "Kuruyia" SOLLIER, Marc AMBAUD (2019 - 2020)
+#
+# | Address | Length | Description                         |
+# |---------|--------|-------------------------------------|
+# | 0x00    | 2      | Magic number ("SI")                 |
+# | 0x02    | 4      | Header magic number ("HEAD")        |
+# | 0x06    | 2      | File version                        |
+# | 0x08    | 4      | Pixel count                         |
+# | 0x0C    | 4      | Image width                         |
+# | 0x10    | 4      | Data magic number ("DATA")          |
+# | 0x14    | ???    | Uncompressed image data as RGBA8888 |
+# "File version", "Pixel count" and "Image width" entries are little-endian, unsigned numbers.
+#
+# Version 2 stores palette-indexed images, for images using at most 256 distinct colors.
+# Its header is the same up to 0x10, then:
+#
+# | Address | Length | Description                         |
+# |---------|--------|-------------------------------------|
+# | 0x10    | 4      | Palette magic number ("PALT")       |
+# | 0x14    | 2      | Palette entry count (N, 1 to 256)   |
+# | 0x16    | 4 * N  | Palette entries as RGBA8888         |
+# | ...     | 4      | Data magic number ("DATA")          |
+# | ...     | ???    | One palette index per pixel (uint8) |
+# "Palette entry count" is a little-endian, unsigned number.
+
+SI2_VERSION_RGBA = 1
+SI2_VERSION_INDEXED = 2
+SI2_MAX_PALETTE_SIZE = 256
+
+
+def require_pillow():
+    if Image is None:
+        exit('This conversion needs the Pillow library, see README.md.')
+
+
+def read_si2(filePath):
+    # Returns the image width and its pixels as a list of RGBA8888 bytes objects, whatever the file version
+    with open(filePath, 'rb') as file:
+        data = file.read()
+
+    version = int.from_bytes(data[0x06:0x08], byteorder='little', signed=False)
+    pixelCount = int.from_bytes(data[0x08:0x0C], byteorder='little', signed=False)
+    lineSize = int.from_bytes(data[0x0C:0x10], byteorder='little', signed=False)
+
+    if version == SI2_VERSION_RGBA:
+        pixels = [data[0x14 + i*4:0x18 + i*4] for i in range(pixelCount)]
+    elif version == SI2_VERSION_INDEXED:
+        paletteSize = int.from_bytes(data[0x14:0x16], byteorder='little', signed=False)
+        palette = [data[0x16 + i*4:0x1A + i*4] for i in range(paletteSize)]
+        indicesStart = 0x16 + paletteSize*4 + 4
+        pixels = [palette[index] for index in data[indicesStart:indicesStart + pixelCount]]
+    else:
+        exit('"{}"\nUnsupported .si2 file version {}.'.format(filePath, version))
+
+    return lineSize, pixels
+
+
+def write_si2(output, lineSize, pixels, indexed):
+    # Writes the pixels (a list of RGBA8888 bytes objects) as a version 1 or 2 .si2 file
+    palette = []
+    if indexed:
+        palette = sorted(set(pixels))
+        if len(palette) > SI2_MAX_PALETTE_SIZE:
+            print('Image uses {} colors, more than the {} an indexed .si2 can hold: writing it as RGBA.'.format(len(palette), SI2_MAX_PALETTE_SIZE))
+            indexed = False
+
+    with open(output, 'wb') as file:
+        file.write(b'SIHEAD')
+        file.write((SI2_VERSION_INDEXED if indexed else SI2_VERSION_RGBA).to_bytes(2, byteorder='little'))
+        file.write(len(pixels).to_bytes(4, byteorder='little'))
+        file.write(lineSize.to_bytes(4, byteorder='little'))
+
+        if indexed:
+            indexOf = {color: index for index, color in enumerate(palette)}
+            file.write(b'PALT')
+            file.write(len(palette).to_bytes(2, byteorder='little'))
+            file.write(b''.join(palette))
+            file.write(b'DATA')
+            file.write(bytes(indexOf[pixel] for pixel in pixels))
+            print('Wrote an indexed image with {} palette entries.'.format(len(palette)))
+        else:
+            file.write(b'DATA')
+            file.write(b''.join(pixels))
+
+
+def is_file_si2(filePath):
+    # Check the magic number
+    with open(filePath, 'rb') as file:
+        return file.read(2) == b'SI'
+
+
+def convert_from_si2(source, output):
+    # Print summary
+    print('Source image: .si2')
+    _, outExtension = os.path.splitext(output)
+    print('Output image: {}'.format(outExtension))
+
+    # Read si2 image data
+    lineSize, pixels = read_si2(source)
+    imageSize = (lineSize, int(len(pixels)/lineSize))
+    imageData = b''.join(pixels)
+
+    # Print summary 2: Electric Boogaloo
+    print('Image size is {}x{}'.format(imageSize[0], imageSize[1]))
+    print()
+    print('Starting conversion...')
+
+    # Save the converted image
+    require_pillow()
+    img = Image.frombytes('RGBA', imageSize, imageData)
+    img.save(output)
+
+
+def convert_si2_to_si2(source, output, indexed):
+    # Print summary
+    print('Source image: .si2')
+    print('Output image: .si2 ({})'.format('indexed' if indexed else 'RGBA'))
+
+    lineSize, pixels = read_si2(source)
+    print('Image size is {}x{}'.format(lineSize, int(len(pixels)/lineSize)))
+    print()
+    print('Starting conversion...')
+
+    write_si2(output, lineSize, pixels, indexed)
+
+
+def convert_to_si2(source, output, indexed):
+    # Print summary
+    _, outExtension = os.path.splitext(source)
+    print('Source image: {}'.format(outExtension))
+    print('Output image: .si2')
+
+    # Read source image
+    require_pillow()
+    with Image.open(source) as img:
+        imageSize = img.size
+
+        if img.mode != 'RGBA':
+            # Convert image mode if unsupported
+            print('Source image mode "{}" is unsupported, attempting conversion...'.format(img.mode))
+
+            imgConvt = img.convert('RGBA')
+            imageData = imgConvt.load()
+        else:
+            imageData = img.load()
+
+    # Print summary 2: Electric Boogaloo
+    print('Image size is {}x{}'.format(imageSize[0], imageSize[1]))
+    print()
+    print('Starting conversion...')
+
+    # Convert the image
+    pixels = [bytes(imageData[x, y]) for y in range(0, imageSize[1]) for x in range(0, imageSize[0])]
+    write_si2(output, imageSize[0], pixels, indexed)
+
+
+def main():
+    # Setup argument parser
+    parser = argparse.ArgumentParser(description='This tool converts images compatible with PIL to the minGL 2 Simple Image format (.si2), and vice versa.')
+    parser.add_argument('-v', '--version', action='version', version='%(prog)s 1.1')
+    parser.add_argument('-i', '--indexed', action='store_true', help='Write a palette-indexed .si2 (version 2) when the image uses at most 256 colors. A .si2 source can then be converted to a .si2 output.')
+    parser.add_argument('<source image file>', help='The path to the image to convert. A .si2 will be converted to the output image type, or re-encoded if the output is also a .si2. Any other image type will be converted to a .si2 file.')
+    parser.add_argument('<output file>', help='The path to output the converted image to.')
+
+    args = vars(parser.parse_args())
+    source = args['<source image file>']
+    output = args['<output file>']
+    indexed = args['indexed']
+
+    # Check that source file exists
+    if not os.path.isfile(source):
+        exit('"{}"\nThe specified path does not exist.'.format(source))
+
+    # Check if source file is in the .si2 format
+    isSourceSi2 = is_file_si2(source)
+
+    _, outExtension = os.path.splitext(output)
+    if isSourceSi2 and outExtension == '.si2':
+        convert_si2_to_si2(source, output, indexed)
+    elif isSourceSi2:
+        convert_from_si2(source, output)
+    else:
+        convert_to_si2(source, output, indexed)
+
+    print('Done!')
+
+    # with Image.open(source) as img:
+    #     for y in range(0, img.height):
+    #         for x in range(0, img.width):
+    #             print(img.getpixel((x, y)))
+
+
+if __name__ == "__main__":
     main()
\ No newline at end of file
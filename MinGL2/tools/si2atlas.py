@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+import argparse
+import os
+
+from img2si import read_si2, write_si2
+
+
+__version__ = "1.0.0"
+__license__ = "MIT"
+
+# Packs several .si2 images into a single .si2 page, and writes the index nsGui::SpriteAtlas reads:
+#
+#   # si2atlas 1.0.0
+#   page <page file name, relative to the index>
+#   <image name> <x> <y> <width> <height>
+#   ...
+#
+# Images are named after their file name, without extension. They are placed with a bottom-left
+# skyline packer: the top edge of the images already placed is kept as a list of horizontal segments,
+# and each image goes where its top edge ends up the lowest, then the leftmost.
+
+TRANSPARENT_PIXEL = b'\x00\x00\x00\x00'
+
+
+def find_position(skyline, width, height, pageWidth):
+    # Returns (x, y) of the best place for a width x height image, or None if it does not fit in the page width
+    best = None
+    for start, (x, _, _) in enumerate(skyline):
+        if x + width > pageWidth:
+            break
+
+        # The image rests on the highest segment it spans
+        y = 0
+        covered = 0
+        index = start
+        while covered < width:
+            y = max(y, skyline[index][1])
+            covered += skyline[index][2]
+            index += 1
+
+        if best is None or (y + height, x) < (best[1] + height, best[0]):
+            best = (x, y)
+
+    return best
+
+
+def place(skyline, x, y, width, height):
+    # Raises the skyline over [x, x + width[ to y + height
+    right = x + width
+    updated = []
+    for segX, segY, segWidth in skyline:
+        segRight = segX + segWidth
+        if segRight <= x or segX >= right:
+            updated.append((segX, segY, segWidth))
+            continue
+        if segX < x:
+            updated.append((segX, segY, x - segX))
+        if segRight > right:
+            updated.append((right, segY, segRight - right))
+
+    updated.append((x, y + height, width))
+    updated.sort()
+
+    # Neighbouring segments at the same height are merged, to keep the list short
+    skyline[:] = []
+    for segment in updated:
+        if skyline and skyline[-1][1] == segment[1]:
+            skyline[-1] = (skyline[-1][0], skyline[-1][1], skyline[-1][2] + segment[2])
+        else:
+            skyline.append(segment)
+
+
+def pack(sizes, pageWidth, padding):
+    # Returns the position of each (width, height) size, in the same order, and the page height
+    skyline = [(0, 0, pageWidth)]
+    positions = [None] * len(sizes)
+    pageHeight = 0
+
+    # Tallest images first: they shape the skyline, smaller ones fill the gaps left next to them
+    for index in sorted(range(len(sizes)), key=lambda i: (-sizes[i][1], -sizes[i][0])):
+        width = min(sizes[index][0] + padding, pageWidth)
+        height = sizes[index][1] + padding
+
+        position = find_position(skyline, width, height, pageWidth)
+        if position is None:
+            return None, 0
+
+        place(skyline, position[0], position[1], width, height)
+        positions[index] = position
+        pageHeight = max(pageHeight, position[1] + sizes[index][1])
+
+    return positions, pageHeight
+
+
+def choose_page_width(sizes, padding):
+    # Tries every power of two wide enough for the widest image, and keeps the smallest page
+    widest = max(width for width, _ in sizes)
+    total = sum(width + padding for width, _ in sizes)
+
+    best = None
+    pageWidth = 1
+    while pageWidth < widest:
+        pageWidth *= 2
+
+    while True:
+        _, pageHeight = pack(sizes, pageWidth, padding)
+        if best is None or pageWidth * pageHeight < best[0] * best[1]:
+            best = (pageWidth, pageHeight)
+        if pageWidth >= total:
+            return best[0]
+        pageWidth *= 2
+
+
+def main():
+    parser = argparse.ArgumentParser(description='This tool packs several minGL 2 Simple Images (.si2) into a single atlas page, and writes the index of the images it contains.')
+    parser.add_argument('-v', '--version', action='version', version='%(prog)s 1.0')
+    parser.add_argument('-o', '--output', required=True, help='Path of the atlas, without extension: <output>.si2 and <output>.atlas are written.')
+    parser.add_argument('-w', '--width', type=int, help='Width of the page. By default, the power of two giving the smallest page is used.')
+    parser.add_argument('-p', '--padding', type=int, default=1, help='Transparent pixels left between images (default: 1).')
+    parser.add_argument('-i', '--indexed', action='store_true', help='Write the page as a palette-indexed .si2 (version 2) when all images use at most 256 colors together.')
+    parser.add_argument('sources', nargs='+', metavar='<source .si2 file>', help='The images to pack.')
+
+    args = parser.parse_args()
+
+    images = []
+    names = set()
+    for source in args.sources:
+        if not os.path.isfile(source):
+            exit('"{}"\nThe specified path does not exist.'.format(source))
+
+        name = os.path.splitext(os.path.basename(source))[0]
+        if name in names:
+            exit('"{}"\nAnother image is already named "{}".'.format(source, name))
+        names.add(name)
+
+        lineSize, pixels = read_si2(source)
+        images.append((name, lineSize, len(pixels) // lineSize, pixels))
+
+    sizes = [(width, height) for _, width, height, _ in images]
+    pageWidth = args.width if args.width else choose_page_width(sizes, args.padding)
+
+    positions, pageHeight = pack(sizes, pageWidth, args.padding)
+    if positions is None:
+        exit('Some images are wider than the page ({} pixels).'.format(pageWidth))
+
+    page = [TRANSPARENT_PIXEL] * (pageWidth * pageHeight)
+    for (_, width, height, pixels), (x, y) in zip(images, positions):
+        for row in range(height):
+            start = (y + row) * pageWidth + x
+            page[start:start + width] = pixels[row * width:(row + 1) * width]
+
+    usedArea = sum(width * height for width, height in sizes)
+    print('Packed {} images in a {}x{} page ({:.0f}% used).'.format(len(images), pageWidth, pageHeight, 100 * usedArea / (pageWidth * pageHeight)))
+
+    write_si2(args.output + '.si2', pageWidth, page, args.indexed)
+
+    with open(args.output + '.atlas', 'w') as index:
+        index.write('# si2atlas {}\n'.format(__version__))
+        index.write('page {}\n'.format(os.path.basename(args.output) + '.si2'))
+        for (name, width, height, _), (x, y) in sorted(zip(images, positions)):
+            index.write('{} {} {} {} {}\n'.format(name, x, y, width, height))
+
+    print('Done!')
+
+
+if __name__ == "__main__":
+    main()
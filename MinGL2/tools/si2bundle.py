@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+import argparse
+import os
+
+
+__version__ = "1.0.0"
+__license__ = "MIT"
+
+# The minGL 2 asset bundle file format specifications, read by nsGui::AssetBundle
+#
+# | Address     | Length | Description                                  |
+# |-------------|--------|----------------------------------------------|
+# | 0x00        | 4      | Magic number ("SI2B")                        |
+# | 0x04        | 2      | Format version (1)                           |
+# | 0x06        | 2      | Entry count (N)                              |
+# | 0x08        | 4      | Alignment of every file content, in bytes    |
+# | 0x0C        | 4      | Total bundle size, in bytes                  |
+# | 0x10        | 40 * N | Entries, sorted by name (byte order)         |
+# | ...         | ???    | File contents, each one starting on a multiple of the alignment |
+#
+# | Entry offset | Length | Description                                       |
+# |--------------|--------|---------------------------------------------------|
+# | 0x00         | 32     | File name, relative to the bundled directory, NUL padded (31 bytes at most) |
+# | 0x20         | 4      | Offset of the file content from the bundle start  |
+# | 0x24         | 4      | Size of the file content, in bytes                |
+# All numbers are little-endian and unsigned.
+#
+# Sorted names let the loader find a file with a binary search directly in the mapped index, and aligned
+# contents let it hand out pixels in place.
+
+BUNDLE_VERSION = 1
+NAME_SIZE = 32
+HEADER_SIZE = 0x10
+ENTRY_SIZE = NAME_SIZE + 8
+
+
+def align(offset, alignment):
+    return (offset + alignment - 1) // alignment * alignment
+
+
+def collect_files(directory):
+    # Returns (name, path) for every file under the directory, names using '/' whatever the platform
+    files = []
+    for root, _, fileNames in os.walk(directory):
+        for fileName in fileNames:
+            path = os.path.join(root, fileName)
+            name = os.path.relpath(path, directory).replace(os.sep, '/')
+            files.append((name.encode('utf-8'), path))
+
+    return sorted(files)
+
+
+def build_bundle(files, alignment):
+    # Returns the bundle holding the files, as bytes
+    offset = align(HEADER_SIZE + ENTRY_SIZE * len(files), alignment)
+    entries = []
+    for name, path in files:
+        size = os.path.getsize(path)
+        entries.append((name, path, offset, size))
+        offset = align(offset + size, alignment)
+
+    # The last content is not padded: the bundle ends right after it
+    totalSize = entries[-1][2] + entries[-1][3] if entries else HEADER_SIZE
+
+    bundle = bytearray()
+    bundle += b'SI2B'
+    bundle += BUNDLE_VERSION.to_bytes(2, byteorder='little')
+    bundle += len(entries).to_bytes(2, byteorder='little')
+    bundle += alignment.to_bytes(4, byteorder='little')
+    bundle += totalSize.to_bytes(4, byteorder='little')
+
+    for name, _, offset, size in entries:
+        bundle += name.ljust(NAME_SIZE, b'\0')
+        bundle += offset.to_bytes(4, byteorder='little')
+        bundle += size.to_bytes(4, byteorder='little')
+
+    for name, path, offset, size in entries:
+        bundle += b'\0' * (offset - len(bundle))
+        with open(path, 'rb') as source:
+            bundle += source.read()
+
+        print('{:<31} {:>9} bytes at 0x{:08X}'.format(name.decode('utf-8'), size, offset))
+
+    return bytes(bundle)
+
+
+def bundle_directory(directory, alignment):
+    # Checks the directory and the alignment, then returns the bundle of every file in the directory
+    if not os.path.isdir(directory):
+        exit('"{}"\nThe specified path is not a directory.'.format(directory))
+    if alignment <= 0 or alignment & (alignment - 1):
+        exit('The alignment must be a power of two.')
+
+    files = collect_files(directory)
+    for name, path in files:
+        if len(name) >= NAME_SIZE:
+            exit('"{}"\nIts name is longer than the {} bytes a bundle entry can hold.'.format(path, NAME_SIZE - 1))
+    if len(files) > 0xFFFF:
+        exit('A bundle holds {} files at most.'.format(0xFFFF))
+
+    bundle = build_bundle(files, alignment)
+    if len(bundle) > 0xFFFFFFFF:
+        exit('The bundle would be larger than 4 GiB.')
+
+    print('Packed {} files in {} bytes.'.format(len(files), len(bundle)))
+    return bundle
+
+
+def main():
+    parser = argparse.ArgumentParser(description='This tool packs every file of a directory (the .si2 images, atlas indexes...) into a single minGL 2 asset bundle.')
+    parser.add_argument('-v', '--version', action='version', version='%(prog)s 1.0')
+    parser.add_argument('-a', '--alignment', type=int, default=64, help='Alignment of every file content, in bytes (default: 64, a cache line).')
+    parser.add_argument('<source directory>', help='The directory to pack, such as sprite/.')
+    parser.add_argument('<output file>', help='The path to write the bundle to.')
+
+    args = vars(parser.parse_args())
+
+    bundle = bundle_directory(args['<source directory>'], args['alignment'])
+    with open(args['<output file>'], 'wb') as file:
+        file.write(bundle)
+
+    print('Done!')
+
+
+if __name__ == "__main__":
+    main()
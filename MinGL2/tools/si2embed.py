@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+import argparse
+import os
+
+from si2bundle import bundle_directory
+
+
+__version__ = "1.0.0"
+__license__ = "MIT"
+
+# Packs a directory into an asset bundle (see si2bundle.py), and writes it as a C++ source file defining
+#
+#   alignas(<alignment>) extern constexpr char <symbol>[] = "...";
+#   extern const size_t <symbol>Size = <bundle size>;
+#
+# so that the bundle is compiled into the executable. nsGui::AssetBundle(const void*, const size_t&) then reads
+# it in place: no file is opened at startup. The user code declares both symbols:
+#
+#   extern const char <symbol>[];
+#   extern const size_t <symbol>Size;
+#
+# The bytes are written as a string literal rather than a list of numbers, which compilers parse far faster.
+
+BYTES_PER_LINE = 64
+
+
+def escape(byte):
+    # Printable characters are kept as is, except those that end or escape the literal, and '?' that could
+    # start a trigraph. Other bytes use three-digit octal escapes, which cannot swallow the next character
+    if 0x20 <= byte < 0x7F and byte not in b'"\\?':
+        return chr(byte)
+    return '\\{:03o}'.format(byte)
+
+
+def write_source(output, bundle, symbol, alignment, directory):
+    with open(output, 'w') as file:
+        file.write('// Generated by si2embed.py from "{}", do not edit.\n'.format(directory))
+        file.write('// Asset bundle of {} bytes, read in place by nsGui::AssetBundle.\n\n'.format(len(bundle)))
+        file.write('#include <cstddef>\n\n')
+        file.write('alignas({}) extern constexpr char {}[] =\n'.format(alignment, symbol))
+
+        for start in range(0, len(bundle), BYTES_PER_LINE):
+            file.write('    "{}"\n'.format(''.join(escape(byte) for byte in bundle[start:start + BYTES_PER_LINE])))
+
+        # The literal ends with a NUL byte that is not part of the bundle
+        file.write('    ;\n\n')
+        file.write('extern const size_t {}Size = sizeof({}) - 1;\n'.format(symbol, symbol))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='This tool compiles every file of a directory into a minGL 2 asset bundle, written as a C++ source file to build into the executable.')
+    parser.add_argument('-v', '--version', action='version', version='%(prog)s 1.0')
+    parser.add_argument('-a', '--alignment', type=int, default=64, help='Alignment of the bundle and of every file content, in bytes (default: 64, a cache line).')
+    parser.add_argument('-s', '--symbol', default='embeddedBundle', help='Name of the array holding the bundle (default: embeddedBundle). Its size is named <symbol>Size.')
+    parser.add_argument('<source directory>', help='The directory to pack, such as sprite/.')
+    parser.add_argument('<output file>', help='The path to write the C++ source file to.')
+
+    args = vars(parser.parse_args())
+    directory = args['<source directory>']
+
+    bundle = bundle_directory(directory, args['alignment'])
+    write_source(args['<output file>'], bundle, args['symbol'], args['alignment'], os.path.basename(os.path.normpath(directory)))
+
+    print('Done!')
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,182 @@
+#include "assetresidency.h"
+#include "assets.h"
+
+/**
+ * @brief Constructs an empty residency manager.
+ *
+ * @param budget The number of bytes the resident images may take, images in use included.
+ */
+assetResidency::assetResidency(size_t budget)
+    : budget(budget)
+{} // assetResidency(size_t budget)
+
+/**
+ * @brief Drops the prefetches that were never used, so that the registry does not keep them.
+ */
+assetResidency::~assetResidency()
+{
+    dropPrefetched();
+} // ~assetResidency()
+
+/**
+ * @brief Computes the memory taken by the pixels of a sprite.
+ *
+ * A bundled sprite reads its pixels from the mapped bundle: they are counted as well, since
+ * they are resident once read and are given back on eviction.
+ *
+ * @param sprite The sprite to measure.
+ * @return size_t The size of its pixels, or indices and palette, in bytes.
+ */
+size_t assetResidency::sizeOf(const nsGui::Sprite& sprite)
+{
+    const size_t pixelSize = sprite.isIndexed() ? sizeof(uint8_t) : sizeof(nsGraphics::RGBAcolor);
+    return sprite.getPixelCount() * pixelSize + sprite.getPalette().size() * sizeof(nsGraphics::RGBAcolor);
+} // sizeOf(const nsGui::Sprite& sprite)
+
+/**
+ * @brief Evicts the least recently used images until the resident ones fit in the budget.
+ *
+ * Images still in use, that is whose sprite is shared outside of the manager, are skipped:
+ * the budget may then be exceeded until they are released and trim() is called.
+ *
+ * @param kept The name of an image never to evict, such as the one being acquired.
+ */
+void assetResidency::evict(const std::string& kept)
+{
+    std::list<entry>::iterator current = entries.end();
+    while (residentBytes > budget && current != entries.begin()) {
+        --current;
+        if (current->name == kept || current->sprite.use_count() > 1)
+            continue;
+
+        const std::string name = current->name;
+        residentBytes -= current->bytes;
+        evictedBytes += current->bytes;
+        index.erase(name);
+        current = entries.erase(current);
+
+        // Once the sprite is gone, its bundle pages are unused
+        assetRegistry::get().discard(name);
+    }
+} // evict(const std::string& kept)
+
+/**
+ * @brief Returns an image, loading it if it is not resident.
+ *
+ * A prefetched image is only waited for if it is still loading. The image becomes the most
+ * recently used, and stays resident at least as long as the returned pointer is kept.
+ *
+ * @param name The name of the sprite, which is its file name without the ".si2" extension.
+ * @return std::shared_ptr<const nsGui::Sprite> The image, positioned at (0, 0).
+ */
+std::shared_ptr<const nsGui::Sprite> assetResidency::acquire(const std::string& name)
+{
+    std::map<std::string, std::list<entry>::iterator>::iterator found = index.find(name);
+    if (found != index.end()) {
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->sprite;
+    }
+
+    prefetched.erase(name);
+    std::shared_ptr<const nsGui::Sprite> sprite = std::make_shared<const nsGui::Sprite>(assetRegistry::get().getSprite(name));
+    const size_t bytes = sizeOf(*sprite);
+
+    entries.push_front(entry{name, sprite, bytes});
+    index[name] = entries.begin();
+    residentBytes += bytes;
+    evict(name);
+
+    return sprite;
+} // acquire(const std::string& name)
+
+/**
+ * @brief Starts loading an image on the registry's threads, so that acquire() does not wait for it.
+ *
+ * Does nothing if the image is resident or already prefetched. The image is counted as resident
+ * once acquired; until then it belongs to the registry.
+ *
+ * @param name The name of the sprite, which is its file name without the ".si2" extension.
+ */
+void assetResidency::prefetch(const std::string& name)
+{
+    if (index.count(name) != 0 || !prefetched.insert(name).second)
+        return;
+
+    assetRegistry::get().preload({name}, 1);
+} // prefetch(const std::string& name)
+
+/**
+ * @brief Evicts images until the resident ones fit in the budget, to call after releasing some.
+ */
+void assetResidency::trim()
+{
+    evict(std::string());
+} // trim()
+
+/**
+ * @brief Drops the prefetched images that were not acquired, whether or not they are loaded yet.
+ *
+ * An image still loading is freed when its task ends, which may then have faulted some of its
+ * bundle pages in again: the kernel reclaims those first under memory pressure.
+ */
+void assetResidency::dropPrefetched()
+{
+    for (const std::string& name : prefetched) {
+        assetRegistry::get().forget(name);
+        assetRegistry::get().discard(name);
+    }
+
+    prefetched.clear();
+} // dropPrefetched()
+
+/**
+ * @brief Tells whether an image is resident, in use or not.
+ *
+ * @param name The name of the sprite, which is its file name without the ".si2" extension.
+ * @return true if acquire() would return it without loading it.
+ */
+bool assetResidency::isResident(const std::string& name) const
+{
+    return index.count(name) != 0;
+} // isResident(const std::string& name) const
+
+/**
+ * @brief Changes the memory budget, evicting images right away if it was lowered.
+ *
+ * @param bytes The number of bytes the resident images may take.
+ */
+void assetResidency::setBudget(size_t bytes)
+{
+    budget = bytes;
+    trim();
+} // setBudget(size_t bytes)
+
+/**
+ * @brief Returns the memory budget.
+ *
+ * @return size_t The number of bytes the resident images may take.
+ */
+size_t assetResidency::getBudget() const
+{
+    return budget;
+} // getBudget() const
+
+/**
+ * @brief Returns the memory taken by the resident images.
+ *
+ * @return size_t The size of the resident images, in bytes.
+ */
+size_t assetResidency::getResidentBytes() const
+{
+    return residentBytes;
+} // getResidentBytes() const
+
+/**
+ * @brief Returns the memory given back by evictions since the manager was created.
+ *
+ * @return size_t The total size of the evicted images, in bytes.
+ */
+size_t assetResidency::getEvictedBytes() const
+{
+    return evictedBytes;
+} // getEvictedBytes() const
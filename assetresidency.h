@@ -0,0 +1,56 @@
+#ifndef ASSETRESIDENCY_H
+#define ASSETRESIDENCY_H
+
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include "mingl/gui/sprite.h"
+
+/**
+ * @brief Keeps large, rarely shown images in memory only while they are worth it.
+ *
+ * An image is loaded on first use, or prefetched on the registry's threads when it is
+ * about to be shown. Once its users have dropped it, it stays resident, most recently
+ * used first, until the resident images exceed the memory budget: the least recently
+ * used ones that are not in use are then evicted.
+ */
+class assetResidency
+{
+private:
+    struct entry {
+        std::string name;
+        std::shared_ptr<const nsGui::Sprite> sprite;
+        size_t bytes;
+    };
+
+    size_t budget;
+    size_t residentBytes = 0;
+    size_t evictedBytes = 0;
+    std::list<entry> entries;
+    std::map<std::string, std::list<entry>::iterator> index;
+    std::set<std::string> prefetched;
+
+    static size_t sizeOf(const nsGui::Sprite& sprite);
+    void evict(const std::string& kept);
+
+public:
+    explicit assetResidency(size_t budget);
+    ~assetResidency();
+    assetResidency(const assetResidency&) = delete;
+    assetResidency& operator=(const assetResidency&) = delete;
+
+    std::shared_ptr<const nsGui::Sprite> acquire(const std::string& name);
+    void prefetch(const std::string& name);
+    void trim();
+    void dropPrefetched();
+
+    bool isResident(const std::string& name) const;
+    void setBudget(size_t bytes);
+    size_t getBudget() const;
+    size_t getResidentBytes() const;
+    size_t getEvictedBytes() const;
+};
+
+#endif // ASSETRESIDENCY_H
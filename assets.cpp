@@ -0,0 +1,243 @@
+#include "assets.h"
+#include <algorithm>
+#include <unistd.h>
+
+#ifdef SPACE_INVADER_EMBEDDED_SPRITES
+#include "embedded_sprites.h"
+#endif
+
+const std::string assetRegistry::bundlePath = "./assets.bundle";
+const std::string assetRegistry::spriteDirectory = "./sprite/";
+const std::vector<std::string> assetRegistry::startupSprites = {"background", "game-menu"};
+
+/**
+ * @brief Opens the game's assets.
+ *
+ * When the sprites are compiled into the executable (qmake CONFIG+=embed_sprites), they are
+ * served from there and no file is ever opened. Otherwise, when "./assets.bundle" exists, it is
+ * mapped once and every sprite is served from it without copying its pixels: startup then takes
+ * a single open() and the game ships as one extra file. Failing both, the sprites are read one by
+ * one from the "./sprite/" directory, which keeps edited sprites usable without rebuilding the
+ * bundle. Nothing else is loaded until asked for, or preloaded.
+ */
+assetRegistry::assetRegistry()
+{
+#ifdef SPACE_INVADER_EMBEDDED_SPRITES
+    bundle.reset(new nsGui::AssetBundle(embeddedSprites, embeddedSpritesSize));
+#else
+    if (access(bundlePath.c_str(), F_OK) == 0)
+        bundle.reset(new nsGui::AssetBundle(bundlePath));
+#endif
+} // assetRegistry()
+
+/**
+ * @brief Waits for the preloading threads before the assets they use are released.
+ */
+assetRegistry::~assetRegistry()
+{
+    for (std::thread& worker : workers)
+        worker.join();
+} // ~assetRegistry()
+
+/**
+ * @brief Returns the registry shared by the whole game, opening the assets on first use.
+ *
+ * @return Reference to the asset registry.
+ */
+assetRegistry& assetRegistry::get()
+{
+    static assetRegistry registry;
+    return registry;
+} // get()
+
+/**
+ * @brief Loads a standalone sprite, from the bundle when there is one or else from its file.
+ *
+ * A bundled sprite reads its pixels in place, so its pages are also faulted in here: otherwise
+ * the first frame drawing it would wait for the disk instead.
+ *
+ * @param name The name of the sprite, which is its file name without the ".si2" extension.
+ * @return nsGui::Sprite The loaded sprite.
+ */
+nsGui::Sprite assetRegistry::loadSprite(const std::string& name) const
+{
+    if (!bundle)
+        return nsGui::Sprite(spriteDirectory + name + ".si2");
+
+    nsGui::Sprite sprite = bundle->getSprite(name + ".si2");
+    bundle->prefault(name + ".si2");
+    return sprite;
+} // loadSprite(const std::string& name) const
+
+/**
+ * @brief Loads the atlas holding the invader, missile and vessel sprites.
+ *
+ * @return std::shared_ptr<const nsGui::SpriteAtlas> The loaded atlas.
+ */
+std::shared_ptr<const nsGui::SpriteAtlas> assetRegistry::loadAtlas() const
+{
+    if (bundle)
+        return std::make_shared<const nsGui::SpriteAtlas>(*bundle, "sprites.atlas");
+
+    return std::make_shared<const nsGui::SpriteAtlas>(spriteDirectory + "sprites.atlas");
+} // loadAtlas() const
+
+/**
+ * @brief Runs queued loading tasks until there is none left. Body of the preloading threads.
+ */
+void assetRegistry::runTasks()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (tasks.empty()) {
+                --activeWorkers;
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+} // runTasks()
+
+/**
+ * @brief Starts loading sprites and the sprite atlas concurrently on a small thread pool.
+ *
+ * The sprites are queued in the given order, then the atlas, and each thread takes the next task
+ * as soon as it is done with the previous one: the sprites needed first should come first, and
+ * threadCount of them load at the same time. It may be called again later, for instance to
+ * prefetch an image shortly before it is shown: the threads still running take the new tasks,
+ * and new ones are started only up to threadCount. getSprite() and
+ * getAtlasSprite() then only wait for the asset they return, while the others keep loading.
+ * Loading errors are reported when the sprite is asked for.
+ *
+ * @param names The names of the sprites to preload, most urgent first.
+ * @param threadCount The number of loading threads, at least one.
+ */
+void assetRegistry::preload(const std::vector<std::string>& names, unsigned threadCount)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (const std::string& name : names) {
+        if (preloaded.count(name) != 0)
+            continue;
+
+        auto task = std::make_shared<std::packaged_task<nsGui::Sprite()>>(
+            [this, name]() { return loadSprite(name); });
+        preloaded[name] = task->get_future();
+        tasks.emplace_back([task]() { (*task)(); });
+    }
+
+    // The atlas is only needed once a game starts, after the menu is shown
+    if (!atlas.valid()) {
+        auto task = std::make_shared<std::packaged_task<std::shared_ptr<const nsGui::SpriteAtlas>()>>(
+            [this]() { return loadAtlas(); });
+        atlas = task->get_future().share();
+        tasks.emplace_back([task]() { (*task)(); });
+    }
+
+    // Threads left from a previous call have returned, or are about to
+    if (activeWorkers == 0) {
+        for (std::thread& worker : workers)
+            worker.join();
+        workers.clear();
+    }
+
+    // The running threads take the new tasks too, so that repeated calls never exceed threadCount
+    for (unsigned i = activeWorkers; i < std::max(threadCount, 1u); ++i) {
+        workers.emplace_back(&assetRegistry::runTasks, this);
+        ++activeWorkers;
+    }
+} // preload(const std::vector<std::string>& names, unsigned threadCount)
+
+/**
+ * @brief Tells whether the assets are served from a bundle rather than from the sprite directory.
+ *
+ * @return true if the sprites are embedded in the executable, or if "./assets.bundle" was found.
+ */
+bool assetRegistry::isBundled() const
+{
+    return bundle != nullptr;
+} // isBundled() const
+
+/**
+ * @brief Returns a standalone sprite, such as a full-screen image.
+ *
+ * A preloaded sprite is handed over once, waiting for its loading task only if it has not finished
+ * yet. Any other sprite is loaded right away on the calling thread.
+ *
+ * @param name The name of the sprite, which is its file name without the ".si2" extension.
+ * @return nsGui::Sprite The sprite, reading its pixels from the bundle when there is one.
+ */
+nsGui::Sprite assetRegistry::getSprite(const std::string& name)
+{
+    std::future<nsGui::Sprite> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = preloaded.find(name);
+        if (found != preloaded.end()) {
+            pending = std::move(found->second);
+            preloaded.erase(found);
+        }
+    }
+
+    return pending.valid() ? pending.get() : loadSprite(name);
+} // getSprite(const std::string& name)
+
+/**
+ * @brief Drops a preloaded sprite that will not be asked for after all.
+ *
+ * Does not wait: a sprite still loading is dropped as soon as its task ends.
+ *
+ * @param name The name of the sprite, which is its file name without the ".si2" extension.
+ */
+void assetRegistry::forget(const std::string& name)
+{
+    std::future<nsGui::Sprite> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = preloaded.find(name);
+        if (found == preloaded.end())
+            return;
+        pending = std::move(found->second);
+        preloaded.erase(found);
+    }
+    // A loaded sprite is freed here, once the lock is released
+} // forget(const std::string& name)
+
+/**
+ * @brief Gives the memory holding a bundled sprite back to the system, once no sprite uses it.
+ *
+ * The pages are read again if the sprite is loaded later. Sprites loaded from the sprite directory
+ * own their pixels, which are freed with the sprite: there is nothing to do for them.
+ *
+ * @param name The name of the sprite, which is its file name without the ".si2" extension.
+ */
+void assetRegistry::discard(const std::string& name) const
+{
+    if (bundle)
+        bundle->discard(name + ".si2");
+} // discard(const std::string& name) const
+
+/**
+ * @brief Creates a sprite showing one image of the game's sprite atlas, without copying its pixels.
+ *
+ * The atlas is loaded on first use, unless preload() already started loading it.
+ *
+ * @param name The name of the image, which is its original file name without extension.
+ * @return nsGui::Sprite A view on the atlas page.
+ */
+nsGui::Sprite assetRegistry::getAtlasSprite(const std::string& name)
+{
+    std::shared_future<std::shared_ptr<const nsGui::SpriteAtlas>> loaded;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!atlas.valid())
+            atlas = std::async(std::launch::deferred, [this]() { return loadAtlas(); }).share();
+        loaded = atlas;
+    }
+
+    return loaded.get()->getSprite(name);
+} // getAtlasSprite(const std::string& name)
@@ -0,0 +1,51 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "mingl/gui/asset_bundle.h"
+#include "mingl/gui/sprite.h"
+#include "mingl/gui/sprite_atlas.h"
+
+class assetRegistry
+{
+private:
+    std::unique_ptr<nsGui::AssetBundle> bundle;
+    std::shared_future<std::shared_ptr<const nsGui::SpriteAtlas>> atlas;
+    std::map<std::string, std::future<nsGui::Sprite>> preloaded;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    unsigned activeWorkers = 0;
+
+    assetRegistry();
+    nsGui::Sprite loadSprite(const std::string& name) const;
+    std::shared_ptr<const nsGui::SpriteAtlas> loadAtlas() const;
+    void runTasks();
+
+public:
+    static const std::string bundlePath;
+    static const std::string spriteDirectory;
+    static const std::vector<std::string> startupSprites;
+
+    static assetRegistry& get();
+    assetRegistry(const assetRegistry&) = delete;
+    assetRegistry& operator=(const assetRegistry&) = delete;
+    ~assetRegistry();
+
+    void preload(const std::vector<std::string>& names, unsigned threadCount);
+    bool isBundled() const;
+    nsGui::Sprite getSprite(const std::string& name);
+    void forget(const std::string& name);
+    void discard(const std::string& name) const;
+    nsGui::Sprite getAtlasSprite(const std::string& name);
+};
+
+#endif // ASSETS_H
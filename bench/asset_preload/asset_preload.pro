@@ -0,0 +1,12 @@
+TEMPLATE = app
+CONFIG += console c++17 no_sfml release thread
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../MinGL2/mingl.pri)
+
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    $$PWD/../../assets.cpp \
+    bench_asset_preload.cpp
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <glob.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "assets.h"
+
+// Measures the startup loading of assetRegistry with 0 (the former sequential path), 1, 2 and 4 preloading threads,
+// on a cold then a warm page cache. Each cell is "critical / all", the median time in milliseconds until:
+//   - critical: the background and the menu are ready, which is what the first frame waits for;
+//   - all: the four screens and the sprite atlas are ready.
+// The registry is a singleton, so each measure runs in its own child process.
+//
+// Usage: asset_preload DIRECTORY [RUNS]
+// DIRECTORY is where the game runs from: it holds sprite/, and assets.bundle to measure the bundle instead.
+
+namespace {
+
+const unsigned threadCounts[] = {0, 1, 2, 4};
+const std::vector<std::string> screens = {"background", "game-menu", "game-win", "game-over"};
+
+// Drops the files matching the pattern from the page cache
+void evictFromPageCache(const char *pattern)
+{
+    glob_t files;
+    if (glob(pattern, 0, nullptr, &files) != 0)
+        return;
+
+    for (size_t i = 0; i < files.gl_pathc; ++i)
+    {
+        const int fd = open(files.gl_pathv[i], O_RDONLY);
+        if (fd < 0)
+            continue;
+
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+
+    globfree(&files);
+}
+
+struct measure {
+    double critical;
+    double all;
+};
+
+// Body of the child process
+measure load(unsigned threadCount, bool cold)
+{
+    if (cold)
+    {
+        evictFromPageCache("sprite/*.si2");
+        evictFromPageCache("sprite/*.atlas");
+        evictFromPageCache("assets.bundle");
+    }
+
+    typedef std::chrono::steady_clock clock;
+    const clock::time_point start = clock::now();
+
+    assetRegistry &registry = assetRegistry::get();
+    // The registry queues the atlas after the screens
+    if (threadCount != 0)
+        registry.preload(screens, threadCount);
+
+    const nsGui::Sprite background = registry.getSprite("background");
+    const nsGui::Sprite menu = registry.getSprite("game-menu");
+    const clock::time_point critical = clock::now();
+
+    const nsGui::Sprite win = registry.getSprite("game-win");
+    const nsGui::Sprite over = registry.getSprite("game-over");
+    const nsGui::Sprite vessel = registry.getAtlasSprite("vessel");
+    const clock::time_point all = clock::now();
+
+    return measure{std::chrono::duration<double, std::milli>(critical - start).count(),
+                   std::chrono::duration<double, std::milli>(all - start).count()};
+}
+
+// Runs load() in a child process, so that it starts with an empty registry
+measure loadInChild(unsigned threadCount, bool cold)
+{
+    int results[2];
+    if (pipe(results) != 0)
+    {
+        std::perror("pipe");
+        std::exit(1);
+    }
+
+    const pid_t child = fork();
+    if (child == 0)
+    {
+        close(results[0]);
+        const measure loaded = load(threadCount, cold);
+        const bool written = write(results[1], &loaded, sizeof(loaded)) == sizeof(loaded);
+        _exit(written ? 0 : 1);
+    }
+
+    close(results[1]);
+    measure loaded = {0., 0.};
+    const bool read = child > 0 && ::read(results[0], &loaded, sizeof(loaded)) == sizeof(loaded);
+    close(results[0]);
+
+    int status = 0;
+    if (child > 0)
+        waitpid(child, &status, 0);
+
+    if (!read || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        std::fprintf(stderr, "the loading process failed\n");
+        std::exit(1);
+    }
+
+    return loaded;
+}
+
+double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || chdir(argv[1]) != 0)
+    {
+        std::fprintf(stderr, "usage: %s DIRECTORY [RUNS]\n", argv[0]);
+        return 1;
+    }
+
+    const int runs = argc > 2 ? std::max(1, std::atoi(argv[2])) : 9;
+    const bool bundled = access(assetRegistry::bundlePath.c_str(), F_OK) == 0;
+
+    std::printf("%s, median of %d runs, critical / all in ms\n", bundled ? "bundle" : "directory", runs);
+    std::printf("cache");
+    for (unsigned threadCount : threadCounts)
+        std::printf("  %u thr          ", threadCount);
+    std::printf("\n");
+
+    for (const bool cold : {true, false})
+    {
+        std::printf("%-5s", cold ? "cold" : "warm");
+        for (unsigned threadCount : threadCounts)
+        {
+            // A first warm load so that the warm runs do not start on a cold cache
+            if (!cold)
+                loadInChild(threadCount, false);
+
+            std::vector<double> critical, all;
+            for (int run = 0; run < runs; ++run)
+            {
+                const measure loaded = loadInChild(threadCount, cold);
+                critical.push_back(loaded.critical);
+                all.push_back(loaded.all);
+            }
+
+            std::printf("  %6.2f / %6.2f", median(critical), median(all));
+        }
+        std::printf("\n");
+    }
+
+    return 0;
+}
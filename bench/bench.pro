@@ -0,0 +1,10 @@
+# Benchmarks backing the figures quoted in the commit messages. Each one is a program printing its measurements.
+# Build them optimised, from a build directory:
+#   qmake ../bench/bench.pro CONFIG+=release && make
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    asset_preload \
+    easing \
+    transition_engine \
+    vec2d
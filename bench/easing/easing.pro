@@ -0,0 +1,9 @@
+TEMPLATE = app
+CONFIG += console c++17 no_sfml release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../MinGL2/mingl.pri)
+
+SOURCES += \
+    bench_easing.cpp
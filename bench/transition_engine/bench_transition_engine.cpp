@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "mingl/transition/itransitionable.h"
+#include "mingl/transition/transition_engine.h"
+#include "list_engine.h"
+
+// Updates 4096 then 100k concurrent 2-component transitions for 200 frames, with the std::list engine of
+// list_engine.h then with the engine of MinGL2, and prints the time per transition per update. The targets only store
+// their values, so that the engines make most of the cost. None of the transitions ends during the measure, so that
+// both engines update the same number of them on every frame.
+
+namespace {
+
+const size_t transitionCounts[] = {4096, 100000};
+size_t transitionCount = 0;
+const size_t updateCount = 200;
+const size_t runCount = 5;
+const std::chrono::microseconds frameTime(16667);
+const std::chrono::hours transitionDuration(1);
+
+// A 2D position, the most common kind of transition in the game
+class listPoint : public nsListEngine::ITransitionable
+{
+public:
+    float x = 0.f;
+    float y = 0.f;
+
+    void getValues(const int&, std::vector<float>& values) override
+    {
+        values = {x, y};
+    }
+
+    void setValues(const int&, const std::vector<float>& values) override
+    {
+        x = values[0];
+        y = values[1];
+    }
+};
+
+class point : public nsTransition::ITransitionable
+{
+public:
+    float x = 0.f;
+    float y = 0.f;
+
+    void getValues(const int&, nsTransition::ValueSpan_t values) override
+    {
+        values[0] = x;
+        values[1] = y;
+    }
+
+    void setValues(const int&, nsTransition::ConstValueSpan_t values) override
+    {
+        x = values[0];
+        y = values[1];
+    }
+};
+
+// Returns the time per transition per update, in nanoseconds
+template <typename Engine>
+double timeUpdates(Engine& engine)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t update = 0; update < updateCount; ++update)
+        engine.update(frameTime);
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / (transitionCount * updateCount);
+}
+
+double runListEngine()
+{
+    std::vector<listPoint> points(transitionCount);
+    nsListEngine::TransitionEngine engine;
+    for (size_t i = 0; i < transitionCount; ++i)
+        engine.startTransition(points[i], 0, transitionDuration, {float(i % 800), float(i % 600)});
+
+    return timeUpdates(engine);
+}
+
+double runEngine()
+{
+    std::vector<point> points(transitionCount);
+    nsTransition::TransitionEngine engine;
+    for (size_t i = 0; i < transitionCount; ++i)
+        engine.startContract(nsTransition::TransitionContract(points[i], 0, transitionDuration,
+                                                              {float(i % 800), float(i % 600)}));
+
+    return timeUpdates(engine);
+}
+
+void report(const char *name, double (*run)())
+{
+    std::vector<double> times;
+    for (size_t i = 0; i < runCount; ++i)
+        times.push_back(run());
+
+    std::sort(times.begin(), times.end());
+    std::printf("%-18s min %6.1f  median %6.1f  max %6.1f ns per transition per update\n",
+                name, times.front(), times[runCount / 2], times.back());
+}
+
+} // namespace
+
+int main()
+{
+    for (size_t count : transitionCounts)
+    {
+        transitionCount = count;
+        std::printf("%zu concurrent 2-component transitions, %zu updates, %zu runs\n",
+                    transitionCount, updateCount, runCount);
+        report("std::list engine", runListEngine);
+        report("MinGL2 engine", runEngine);
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#ifndef LIST_ENGINE_H
+#define LIST_ENGINE_H
+
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <vector>
+#include "mingl/transition/transition_types.h"
+
+// Reference copy of the transition engine as it was before it stored its transitions contiguously: a std::list
+// of transitions, a vector allocated by each transition on each update, and a clock read per transition. Only the
+// update path is kept, with the same code, so that the benchmark compares it with the engine of MinGL2.
+
+namespace nsListEngine
+{
+
+using nsTransition::SystemDuration_t;
+using nsTransition::SystemTimePoint_t;
+
+// The former ITransitionable, which took its values by vector
+class ITransitionable
+{
+public:
+    virtual ~ITransitionable() {}
+    virtual void getValues(const int& id, std::vector<float>& values) = 0;
+    virtual void setValues(const int& id, const std::vector<float>& values) = 0;
+};
+
+class Transition
+{
+public:
+    Transition(ITransitionable& target, const int& id, const SystemDuration_t& duration,
+               const std::vector<float>& destination)
+        : m_id(id)
+        , m_target(target)
+        , m_destination(destination)
+        , m_duration(duration)
+        , m_startTime(std::chrono::steady_clock::now())
+        , m_elapsed(0)
+        , m_reverse(false)
+        , m_finished(false)
+    {
+        m_target.getValues(m_id, m_beginning);
+    }
+
+    void addToElapsed(const SystemDuration_t& addedTime)
+    {
+        setElapsed(m_elapsed + addedTime);
+    }
+
+    bool isFinished() const
+    {
+        return m_finished;
+    }
+
+private:
+    void setElapsed(const SystemDuration_t& elapsed)
+    {
+        // Don't allow to set the elapsed time if the start time is ahead of clock
+        if (std::chrono::steady_clock::now() < m_startTime) return;
+
+        m_elapsed = elapsed;
+        updateValues();
+    }
+
+    void updateValues()
+    {
+        if (m_finished)
+            return;
+
+        float elapsedProgress = m_elapsed / m_duration;
+        elapsedProgress = std::max(0.f, std::min(elapsedProgress, 1.f));
+
+        float effectiveElapsedProgress = (!m_reverse) ? elapsedProgress : 1 - elapsedProgress;
+
+        std::vector<float> updatedValues(m_beginning.size());
+        for (size_t i = 0; i < m_beginning.size(); ++i)
+        {
+            updatedValues[i] = ((m_destination[i] - m_beginning[i]) * effectiveElapsedProgress) + m_beginning[i];
+        }
+
+        m_target.setValues(m_id, updatedValues);
+
+        // The benchmark only runs finite transitions, which end at their destination
+        if (elapsedProgress == 1.f)
+            m_finished = true;
+    }
+
+    const int m_id;
+    ITransitionable& m_target;
+    std::vector<float> m_beginning;
+    const std::vector<float> m_destination;
+    const SystemDuration_t m_duration;
+    SystemTimePoint_t m_startTime;
+    SystemDuration_t m_elapsed;
+    bool m_reverse;
+    bool m_finished;
+};
+
+class TransitionEngine
+{
+public:
+    void update(const std::chrono::microseconds& delta)
+    {
+        std::list<Transition>::iterator iter = m_transitionList.begin();
+        while (iter != m_transitionList.end())
+        {
+            if (iter->isFinished())
+            {
+                m_transitionList.erase(iter++);
+            }
+            else
+            {
+                iter->addToElapsed(delta);
+                ++iter;
+            }
+        }
+    }
+
+    void startTransition(ITransitionable& target, const int& id, const SystemDuration_t& duration,
+                         const std::vector<float>& destination)
+    {
+        m_transitionList.emplace_back(target, id, duration, destination);
+    }
+
+    size_t getTransitionCount() const
+    {
+        return m_transitionList.size();
+    }
+
+private:
+    std::list<Transition> m_transitionList;
+};
+
+} // namespace nsListEngine
+
+#endif // LIST_ENGINE_H
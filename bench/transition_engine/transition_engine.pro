@@ -0,0 +1,12 @@
+TEMPLATE = app
+CONFIG += console c++17 no_sfml release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../MinGL2/mingl.pri)
+
+HEADERS += \
+    list_engine.h
+
+SOURCES += \
+    bench_transition_engine.cpp
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "mingl/graphics/vec2d.h"
+#include "old_vec2d.h"
+
+// Runs the four vector loops that the game and MinGL2 use the most on 4096 vectors for 200 iterations, with the
+// out-of-line Vec2D of old_vec2d.h then with the header-only Vec2D of MinGL2, and prints the time per vector.
+// isColliding() does not compute the same thing in both: the old one compared magnitudes with two sqrt per corner,
+// the current one tests the rectangle.
+
+namespace {
+
+const size_t vectorCount = 4096;
+const size_t iterationCount = 200;
+const size_t runCount = 5;
+
+// Keeps the results alive, so that the compiler cannot drop the loops
+volatile long long sink = 0;
+
+typedef std::chrono::steady_clock clock;
+
+double nanosecondsPerVector(const clock::time_point& start)
+{
+    return std::chrono::duration<double, std::nano>(clock::now() - start).count() / (vectorCount * iterationCount);
+}
+
+template <typename Vec>
+std::vector<Vec> makeVectors(int seed)
+{
+    std::vector<Vec> vectors;
+    vectors.reserve(vectorCount);
+    for (size_t i = 0; i < vectorCount; ++i)
+        vectors.push_back(Vec(int(i * 7 + seed) % 830, int(i * 13 + seed) % 590));
+    return vectors;
+}
+
+// The invaders of a formation, moved to their home shifted by the formation offset
+template <typename Vec>
+double homePlusOffset()
+{
+    const std::vector<Vec> homes = makeVectors<Vec>(1);
+    std::vector<Vec> positions(vectorCount);
+
+    const clock::time_point start = clock::now();
+    for (size_t iteration = 0; iteration < iterationCount; ++iteration)
+    {
+        const Vec offset(int(iteration), int(iteration / 2));
+        for (size_t i = 0; i < vectorCount; ++i)
+            positions[i] = homes[i] + offset;
+    }
+    const double time = nanosecondsPerVector(start);
+
+    sink = sink + positions[iterationCount % vectorCount].getX();
+    return time;
+}
+
+// Bullets moved by a scaled direction
+template <typename Vec>
+double compoundAdd()
+{
+    std::vector<Vec> positions = makeVectors<Vec>(2);
+
+    const clock::time_point start = clock::now();
+    for (size_t iteration = 0; iteration < iterationCount; ++iteration)
+    {
+        for (size_t i = 0; i < vectorCount; ++i)
+            positions[i] += Vec(1, -1) * 2;
+    }
+    const double time = nanosecondsPerVector(start);
+
+    sink = sink + positions[iterationCount % vectorCount].getY();
+    return time;
+}
+
+// Points tested against a box given by two corners, in either order
+template <typename Vec>
+double isColliding()
+{
+    const std::vector<Vec> points = makeVectors<Vec>(3);
+    long long hits = 0;
+
+    const clock::time_point start = clock::now();
+    for (size_t iteration = 0; iteration < iterationCount; ++iteration)
+    {
+        const Vec firstCorner(int(iteration), 100);
+        const Vec secondCorner(700, int(500 - iteration));
+        for (size_t i = 0; i < vectorCount; ++i)
+            hits += points[i].isColliding(firstCorner, secondCorner);
+    }
+    const double time = nanosecondsPerVector(start);
+
+    sink = sink + hits;
+    return time;
+}
+
+// The middle of the smallest corner and a point, as the layout code computes it
+template <typename Vec>
+double minAndDivision()
+{
+    const std::vector<Vec> first = makeVectors<Vec>(4);
+    const std::vector<Vec> second = makeVectors<Vec>(5);
+    long long total = 0;
+
+    const clock::time_point start = clock::now();
+    for (size_t iteration = 0; iteration < iterationCount; ++iteration)
+    {
+        for (size_t i = 0; i < vectorCount; ++i)
+            total += (Vec::min(first[i], second[(i + iteration) % vectorCount]) / 2.f).getX();
+    }
+    const double time = nanosecondsPerVector(start);
+
+    sink = sink + total;
+    return time;
+}
+
+void printTimes(const char *name, double (*run)())
+{
+    std::vector<double> times;
+    for (size_t i = 0; i < runCount; ++i)
+        times.push_back(run());
+
+    std::sort(times.begin(), times.end());
+    std::printf("  %-8s min %6.2f  median %6.2f  max %6.2f ns per vector\n",
+                name, times.front(), times[runCount / 2], times.back());
+}
+
+void report(const char *name, double (*runOld)(), double (*runNew)())
+{
+    std::printf("%s\n", name);
+    printTimes("old", runOld);
+    printTimes("current", runNew);
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%zu vectors, %zu iterations, %zu runs, sizeof: old %zu, current %zu bytes\n",
+                vectorCount, iterationCount, runCount, sizeof(nsOldVec2D::Vec2D), sizeof(nsGraphics::Vec2D));
+    report("pos = home + offset", homePlusOffset<nsOldVec2D::Vec2D>, homePlusOffset<nsGraphics::Vec2D>);
+    report("pos += Vec2D(1, -1) * 2", compoundAdd<nsOldVec2D::Vec2D>, compoundAdd<nsGraphics::Vec2D>);
+    report("isColliding()", isColliding<nsOldVec2D::Vec2D>, isColliding<nsGraphics::Vec2D>);
+    report("min() + division", minAndDivision<nsOldVec2D::Vec2D>, minAndDivision<nsGraphics::Vec2D>);
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <cmath>
+#include <utility>
+#include "old_vec2d.h"
+
+nsOldVec2D::Vec2D::Vec2D(const int& x, const int& y)
+    : m_x(x)
+    , m_y(y)
+{} // Vec2D()
+
+nsOldVec2D::Vec2D::Vec2D(const Vec2D& pos)
+    : m_x(pos.getX())
+    , m_y(pos.getY())
+{} // Vec2D()
+
+nsOldVec2D::Vec2D nsOldVec2D::Vec2D::operator+(const Vec2D& pos) const
+{
+    return Vec2D(m_x + pos.getX(), m_y + pos.getY());
+} // operator+()
+
+nsOldVec2D::Vec2D nsOldVec2D::Vec2D::operator*(const float& n) const
+{
+    return Vec2D(m_x * n, m_y * n);
+} // operator*()
+
+nsOldVec2D::Vec2D nsOldVec2D::Vec2D::operator/(const float &n) const
+{
+    return Vec2D(m_x / n, m_y / n);
+} // operator/()
+
+bool nsOldVec2D::Vec2D::operator==(const Vec2D& pos) const
+{
+    return m_x == pos.getX() && m_y == pos.getY();
+} // operator==()
+
+bool nsOldVec2D::Vec2D::operator<=(const Vec2D& pos) const
+{
+    return computeMagnitude() <= pos.computeMagnitude();
+} // operator<=()
+
+bool nsOldVec2D::Vec2D::operator>=(const Vec2D& pos) const
+{
+    return computeMagnitude() >= pos.computeMagnitude();
+} // operator>=()
+
+nsOldVec2D::Vec2D& nsOldVec2D::Vec2D::operator=(const Vec2D& pos)
+{
+    m_x = pos.getX();
+    m_y = pos.getY();
+
+    return *this;
+} // operator=()
+
+nsOldVec2D::Vec2D& nsOldVec2D::Vec2D::operator+=(const Vec2D& pos)
+{
+    m_x += pos.getX();
+    m_y += pos.getY();
+
+    return *this;
+} // operator+=()
+
+nsOldVec2D::Vec2D nsOldVec2D::Vec2D::min(const Vec2D& p1, const Vec2D& p2)
+{
+    if (p1.getX() < p2.getX()) return p1;
+    else if (p1.getX() == p2.getX() && p1.getY() < p2.getY()) return p1;
+    return p2;
+} // min()
+
+bool nsOldVec2D::Vec2D::isColliding(Vec2D firstCorner, Vec2D secondCorner) const
+{
+    // On inverse les coordonnées si nécessaire
+    if (secondCorner.getX() < firstCorner.getX())
+        std::swap(secondCorner.m_x, firstCorner.m_x);
+
+    if (secondCorner.getY() < firstCorner.getY())
+        std::swap(secondCorner.m_y, firstCorner.m_y);
+
+    // On retourne si notre vecteur est entre ces deux coins
+    return (operator>=(firstCorner) && operator<=(secondCorner));
+} // isColliding()
+
+double nsOldVec2D::Vec2D::computeMagnitude() const
+{
+    return sqrt(m_x * m_x + m_y * m_y);
+} // getMagnitude()
+
+int nsOldVec2D::Vec2D::getX() const
+{
+    return m_x;
+} // getX()
+
+int nsOldVec2D::Vec2D::getY() const
+{
+    return m_y;
+} // getY()
+
+std::ostream& nsOldVec2D::Vec2D::_Edit(std::ostream& os) const
+{
+    os << "X: " << m_x << ", Y: " << m_y;
+    return os;
+} // _Edit()
@@ -0,0 +1,45 @@
+#ifndef OLD_VEC2D_H
+#define OLD_VEC2D_H
+
+#include "mingl/tools/ieditable.h"
+
+// Reference copy of Vec2D as it was before it became header-only: derived from nsUtil::IEditable, so 16 bytes with
+// a vptr and a user-defined copy, and defined out of line in old_vec2d.cpp, where the compiler cannot inline it.
+// Only the functions used by the benchmark are kept, with the same code.
+
+namespace nsOldVec2D
+{
+
+class Vec2D : public nsUtil::IEditable
+{
+public:
+    Vec2D(const int& x = 0, const int& y = 0);
+    Vec2D(const Vec2D& pos);
+
+    Vec2D operator+(const Vec2D& pos) const;
+    Vec2D operator*(const float& n) const;
+    Vec2D operator/(const float& n) const;
+    bool operator==(const Vec2D& pos) const;
+    bool operator<=(const Vec2D& pos) const;
+    bool operator>=(const Vec2D& pos) const;
+    Vec2D& operator=(const Vec2D& pos);
+    Vec2D& operator+=(const Vec2D& pos);
+
+    static Vec2D min(const Vec2D& p1, const Vec2D& p2);
+    bool isColliding(Vec2D firstCorner, Vec2D secondCorner) const;
+    double computeMagnitude() const;
+
+    int getX() const;
+    int getY() const;
+
+protected:
+    virtual std::ostream& _Edit(std::ostream& os = std::cout) const override;
+
+private:
+    int m_x;
+    int m_y;
+}; // class Vec2D
+
+} // namespace nsOldVec2D
+
+#endif // OLD_VEC2D_H
@@ -0,0 +1,13 @@
+TEMPLATE = app
+CONFIG += console c++17 no_sfml release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../MinGL2/mingl.pri)
+
+HEADERS += \
+    old_vec2d.h
+
+SOURCES += \
+    bench_vec2d.cpp \
+    old_vec2d.cpp
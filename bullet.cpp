@@ -1,16 +1,19 @@
 #include "bullet.h"
+#include "assets.h"
 
-bullet::bullet(nsGraphics::Vec2D coords) : entity(coords, nsGui::Sprite("./sprite/missile.si2")) {}
+bullet::bullet(nsGraphics::Vec2D coords) : entity(coords, assetRegistry::get().getAtlasSprite("missile")) {}
 
 /**
  * @brief Moves the bullet upwards by decreasing its Y position.
  *
- * This function retrieves the current position of the bullet,
- * subtracts 10 units from its Y coordinate to move it upwards,
- * and updates the bullet's position accordingly.
+ * The bullet travels at speed pixels per second: the distance covered during delta
+ * is computed in sub-pixel precision, so the motion stays smooth and independent
+ * of the frame rate.
+ *
+ * @param delta The simulated time elapsed since the previous move.
  */
-void bullet::move() {
-    nsGraphics::Vec2D position = getPosition();
-    position.setY(position.getY() - 7.5);
-    setPosition(position);
-} // move()
\ No newline at end of file
+void bullet::move(const std::chrono::microseconds& delta) {
+    typedef nsGraphics::Vec2F::Scalar_t Scalar_t;
+    const Scalar_t seconds = nsGraphics::scalarFromRatio<Scalar_t>(delta.count(), 1000000);
+    setPosition(getExactPosition() - nsGraphics::Vec2F(0, Scalar_t(speed) * seconds));
+} // move(const std::chrono::microseconds& delta)
\ No newline at end of file
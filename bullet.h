@@ -1,14 +1,17 @@
 #ifndef BULLET_H
 #define BULLET_H
 
+#include <chrono>
 #include "entity.h"
 
 class bullet : public entity
 {
 public:
+    static constexpr int speed = 225; // pixels per second
+
     bullet(nsGraphics::Vec2D coords);
     virtual ~bullet() = default;
-    void move();
+    void move(const std::chrono::microseconds& delta);
 };
 
 #endif // BULLET_H
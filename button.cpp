@@ -1,40 +1,85 @@
 #include "button.h"
 
-#include <iostream>
-
+/**
+ * @brief Constructs a button and computes its retained geometry once.
+ *
+ * The background rectangle and the label text are built here and only rebuilt
+ * when the label changes, so drawing and hit-testing never recompute them.
+ */
 Button::Button(const nsGraphics::Vec2D& pos, const nsGraphics::Vec2D& size,
            const std::string& label, const std::function<void()>& onClick,
            nsGui::GlutFont::GlutFonts font)
-    : label(label), onClick(onClick), font(font)
+    : label(label), font(font), onClick(onClick)
+    , background(nsGraphics::Vec2D(), nsGraphics::Vec2D(), nsGraphics::KTransparent)
+    , text(nsGraphics::Vec2D(), label, nsGraphics::KWhite, font)
 {
     int textHeight = size.getY() - 2;
     this->pos = pos - nsGraphics::Vec2D(1, textHeight + 1);
     this->size = nsGraphics::Vec2D(size.getX() + 2, textHeight + 2);
-}
+    layout();
+} // Button(...)
 
-void Button::draw(MinGL& window) const{
+/**
+ * @brief Computes the cached background bounds and text placement.
+ */
+void Button::layout() {
     int textHeight = size.getY() - 2;
 
-    nsGraphics::Vec2D rectPos = pos - nsGraphics::Vec2D(1, textHeight + 1);
-    nsGraphics::Vec2D rectSize = nsGraphics::Vec2D(size.getX() + 2, textHeight + 2);
+    boundsStart = pos - nsGraphics::Vec2D(1, textHeight + 1);
+    boundsEnd = boundsStart + nsGraphics::Vec2D(size.getX() + 2, textHeight + 2);
 
-    nsGraphics::Vec2D textPos = pos;
+    background.setFirstPosition(boundsStart);
+    background.setSecondPosition(boundsEnd);
+    background.setFillColor(isHovered ? hoverBg : normalBg);
 
-    window << nsShape::Rectangle(rectPos, rectPos + rectSize, isHovered ? hoverBg : normalBg);
-    window << nsGui::Text(textPos, label, nsGraphics::KWhite, this->font);
-}
+    text.setPosition(pos);
+    text.setContent(label);
+    dirty = true;
+} // layout()
+
+void Button::draw(MinGL& window) const{
+    window << background;
+    window << text;
+} // draw(MinGL& window) const
 
 bool Button::isMouseOver(const nsGraphics::Vec2D& mouse) const{
-    int textHeight = size.getY() - 2;
-    nsGraphics::Vec2D rectPos = pos - nsGraphics::Vec2D(1, textHeight + 1);
-    nsGraphics::Vec2D rectSize = nsGraphics::Vec2D(size.getX() + 2, textHeight + 2);
+    return mouse.getX() >= boundsStart.getX() && mouse.getX() <= boundsEnd.getX() &&
+           mouse.getY() >= boundsStart.getY() && mouse.getY() <= boundsEnd.getY();
+} // isMouseOver(const nsGraphics::Vec2D& mouse) const
+
+/**
+ * @brief Updates the hover state, marking the button dirty only when it changes.
+ */
+void Button::setHover(bool hover) {
+    if (hover == isHovered)
+        return;
+
+    isHovered = hover;
+    background.setFillColor(isHovered ? hoverBg : normalBg);
+    dirty = true;
+} // setHover(bool hover)
+
+void Button::setHoverBg(const nsGraphics::RGBAcolor& color) {
+    hoverBg = color;
+    if (isHovered) {
+        background.setFillColor(hoverBg);
+        dirty = true;
+    }
+} // setHoverBg(const nsGraphics::RGBAcolor& color)
+
+/**
+ * @brief Changes the label, rebuilding the retained text only when it differs.
+ */
+void Button::setLabel(const std::string& newLabel) {
+    if (newLabel == label)
+        return;
 
-    return mouse.getX() >= rectPos.getX() && mouse.getX() <= rectPos.getX() + rectSize.getX() &&
-           mouse.getY() >= rectPos.getY() && mouse.getY() <= rectPos.getY() + rectSize.getY();
-}
+    label = newLabel;
+    layout();
+} // setLabel(const std::string& newLabel)
 
 void Button::tryClick(const nsGraphics::Vec2D& mouse, bool mousePressed) {
     if (mousePressed && isMouseOver(mouse)) {
         onClick();
     }
-}
+} // tryClick(const nsGraphics::Vec2D& mouse, bool mousePressed)
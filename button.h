@@ -16,12 +16,23 @@ public:
     void draw(MinGL& window) const;
 
     bool isMouseOver(const nsGraphics::Vec2D& mouse) const;
-    void setHovered(bool hovered) { isHovered = hovered; }
-    void setHoverBg(const nsGraphics::RGBAcolor& color) { hoverBg = color; }
+    void setHovered(bool hovered) { setHover(hovered); }
+    void setHoverBg(const nsGraphics::RGBAcolor& color);
     void tryClick(const nsGraphics::Vec2D& mouse, bool mousePressed);
-    void setHover(bool hover) { isHovered = hover; }
-        
+    void setHover(bool hover);
+    bool getHover() const { return isHovered; }
+    void setLabel(const std::string& label);
+    const std::string& getLabel() const { return label; }
+
+    const nsGraphics::Vec2D& getBoundsStart() const { return boundsStart; }
+    const nsGraphics::Vec2D& getBoundsEnd() const { return boundsEnd; }
+    const std::function<void()>& getOnClick() const { return onClick; }
+    bool isDirty() const { return dirty; }
+    void clearDirty() { dirty = false; }
+
 private:
+    void layout();
+
     std::string label;
     bool isHovered = false;
     nsGraphics::Vec2D pos, size;
@@ -29,6 +40,11 @@ private:
     nsGraphics::RGBAcolor hoverBg = nsGraphics::KGray;
     nsGraphics::RGBAcolor normalBg = nsGraphics::KTransparent;
     std::function<void()> onClick;
+
+    nsGraphics::Vec2D boundsStart, boundsEnd;
+    nsShape::Rectangle background;
+    nsGui::Text text;
+    bool dirty = true;
 };
 
 #endif // BUTTON_H
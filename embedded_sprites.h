@@ -0,0 +1,12 @@
+#ifndef EMBEDDED_SPRITES_H
+#define EMBEDDED_SPRITES_H
+
+#include <cstddef>
+
+// Asset bundle of the sprite/ directory, compiled into the executable when building with
+// qmake CONFIG+=embed_sprites. Both are defined in embedded_sprites.cpp, generated in the
+// build directory by MinGL2/tools/si2embed.py.
+extern const char embeddedSprites[];
+extern const size_t embeddedSpritesSize;
+
+#endif // EMBEDDED_SPRITES_H
@@ -4,45 +4,68 @@
  * @brief Constructs an entity with the specified coordinates and sprite.
  *
  * Initializes the entity's sprite and sets its position to the given coordinates.
+ * The position is simulated with sub-pixel precision and only rounded to whole pixels
+ * when the sprite is drawn or handed out.
  *
  * @param coords The initial position of the entity as a 2D vector.
  * @param sprite The sprite to be associated with the entity.
  */
 entity::entity(nsGraphics::Vec2D coords, nsGui::Sprite sprite)
-    : sprite(sprite) {
+    : sprite(sprite), position(coords) {
          this->sprite.setPosition(coords);
     } // entity(nsGraphics::Vec2D coords, nsGui::Sprite sprite)
 
 /**
  * @brief Draws the entity's sprite onto the given MinGL window.
  *
- * This function renders the entity's sprite by sending it to the specified MinGL window.
+ * This function moves the sprite to the entity's position rounded to the nearest pixel,
+ * then renders it by sending it to the specified MinGL window.
  *
  * @param window Reference to the MinGL window where the sprite will be drawn.
  */
 void entity::draw(MinGL& window) {
+    sprite.setPosition(getPosition());
     window << sprite;
 } // draw(MinGL& window)
 
 /**
- * @brief Retrieves the current position of the entity.
+ * @brief Retrieves the current position of the entity, rounded to the nearest pixel.
  *
  * @return nsGraphics::Vec2D The position of the entity as a 2D vector.
  */
 nsGraphics::Vec2D entity::getPosition() const {
-    return sprite.getPosition();
+    return position.toVec2D();
 } // getPosition() const
 
 /**
- * @brief Sets the position of the entity's sprite to the specified coordinates.
+ * @brief Retrieves the current position of the entity with its sub-pixel part.
+ *
+ * @return nsGraphics::Vec2F The exact simulated position of the entity.
+ */
+nsGraphics::Vec2F entity::getExactPosition() const {
+    return position;
+} // getExactPosition() const
+
+/**
+ * @brief Sets the position of the entity to the specified pixel coordinates.
  *
  * @param position The new position for the entity as a 2D vector.
  */
 void entity::setPosition(nsGraphics::Vec2D position)
 {
-    sprite.setPosition(position);
+    this->position = nsGraphics::Vec2F(position);
 } // setPosition(nsGraphics::Vec2D position)
 
+/**
+ * @brief Sets the position of the entity to the specified sub-pixel coordinates.
+ *
+ * @param position The new exact position for the entity.
+ */
+void entity::setPosition(const nsGraphics::Vec2F& position)
+{
+    this->position = position;
+} // setPosition(const nsGraphics::Vec2F& position)
+
 /**
  * @brief Computes the size of the entity's sprite.
  *
@@ -55,43 +78,40 @@ nsGraphics::Vec2D entity::computeSize() {
 } // computeSize()
 
 /**
- * @brief Checks if the entity's sprite is colliding with another sprite.
+ * @brief Computes the rectangle covered by the entity's sprite at its rounded position.
  *
- * This function determines if the bounding boxes of the two sprites overlap,
- * indicating a collision.
- *
- * @param other The other sprite to check for collision against.
- * @return true if the sprites are colliding, false otherwise.
+ * @return nsGraphics::Rect The half-open bounding box of the entity.
  */
-bool entity::isColliding(const nsGui::Sprite& other) const
+nsGraphics::Rect entity::getBounds() const
 {
-    nsGraphics::Vec2D posA = sprite.getPosition();
-    nsGraphics::Vec2D sizeA = sprite.computeSize();
-    nsGraphics::Vec2D posB = other.getPosition();
-    nsGraphics::Vec2D sizeB = other.computeSize();
-
-    int leftA = posA.getX();
-    int rightA = posA.getX() + sizeA.getX();
-    int topA = posA.getY();
-    int bottomA = posA.getY() + sizeA.getY();
+    return nsGraphics::Rect::fromPositionSize(getPosition(), sprite.computeSize());
+} // getBounds() const
 
-    int leftB = posB.getX();
-    int rightB = posB.getX() + sizeB.getX();
-    int topB = posB.getY();
-    int bottomB = posB.getY() + sizeB.getY();
-
-    return !(rightA < leftB || leftA > rightB || bottomA < topB || topA > bottomB);
-} // isColliding(const nsGui::Sprite& other) const
+/**
+ * @brief Checks if the entity is colliding with another entity.
+ *
+ * This function determines if the bounding boxes of the two entities overlap,
+ * indicating a collision. Boxes that only share an edge do not collide.
+ *
+ * @param other The other entity to check for collision against.
+ * @return true if the entities are colliding, false otherwise.
+ */
+bool entity::isColliding(const entity& other) const
+{
+    return getBounds().intersects(other.getBounds());
+} // isColliding(const entity& other) const
 
 /**
  * @brief Returns a reference to the sprite associated with this entity.
  *
  * This function provides access to the underlying nsGui::Sprite object
  * representing the visual appearance of the entity. Modifying the returned
- * sprite will directly affect how the entity is rendered.
+ * sprite will directly affect how the entity is rendered. The sprite is first moved
+ * to the entity's rounded position, so that its bounds match what is drawn.
  *
  * @return Reference to the entity's nsGui::Sprite.
  */
 nsGui::Sprite& entity::getSprite() {
+    sprite.setPosition(getPosition());
     return sprite;
 } // getSprite()
@@ -1,20 +1,26 @@
 #ifndef ENTITY_H
 #define ENTITY_H
 
+#include "mingl/graphics/vec2f.h"
 #include "mingl/gui/sprite.h"
 
 class entity
 {
 protected:
     nsGui::Sprite sprite;
+    nsGraphics::Vec2F position;
 
 public:
     entity(nsGraphics::Vec2D coords, nsGui::Sprite sprite);
+    virtual ~entity() = default;
     virtual void draw(MinGL& window);
     nsGraphics::Vec2D getPosition() const;
+    nsGraphics::Vec2F getExactPosition() const;
     void setPosition(nsGraphics::Vec2D position);
+    void setPosition(const nsGraphics::Vec2F& position);
     nsGraphics::Vec2D computeSize();
-    bool isColliding(const nsGui::Sprite& other) const;
+    nsGraphics::Rect getBounds() const;
+    bool isColliding(const entity& other) const;
     nsGui::Sprite& getSprite();
 };
 
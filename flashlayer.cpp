@@ -0,0 +1,69 @@
+#include "flashlayer.h"
+
+/**
+ * @brief Constructs an empty flash layer.
+ *
+ * @param transitions The engine driving the fades, which must outlive the layer.
+ * @param duration The time a flash takes to fade out.
+ */
+flashLayer::flashLayer(nsTransition::TransitionEngine &transitions, const std::chrono::milliseconds &duration)
+    : transitions(transitions)
+    , duration(duration)
+{} // flashLayer(nsTransition::TransitionEngine &transitions, const std::chrono::milliseconds &duration)
+
+/**
+ * @brief Stops the fades still running, so that the engine does not write to the destroyed flashes.
+ */
+flashLayer::~flashLayer()
+{
+    for (flash &current : flashes)
+        if (!current.finished)
+            transitions.finishEveryTransitionOfTarget(current.rectangle, nsTransition::Transition::FINISH_CURRENT);
+} // ~flashLayer()
+
+/**
+ * @brief Starts a white flash fading out over the given area.
+ *
+ * @param bounds The area to flash.
+ */
+void flashLayer::start(const nsGraphics::Rect& bounds)
+{
+    flashes.push_back(flash{nsShape::Rectangle(bounds.getMin(), bounds.getMax(), nsGraphics::KWhite), false});
+    flash &added = flashes.back();
+
+    nsTransition::TransitionContract fade(added.rectangle, nsShape::Rectangle::TRANSITION_FILL_COLOR_ALPHA,
+                                          duration, {0.f});
+    fade.setEasing(nsTransition::EASING_QUAD_OUT);
+    // The list never moves its elements, so the flash can be referred to until it is removed
+    fade.setDestinationCallback([&added]() { added.finished = true; });
+    transitions.startContract(fade);
+} // start(const nsGraphics::Rect& bounds)
+
+/**
+ * @brief Removes the flashes whose fade has ended. To call after updating the engine.
+ */
+void flashLayer::removeFinished()
+{
+    flashes.remove_if([](const flash& current) { return current.finished; });
+} // removeFinished()
+
+/**
+ * @brief Returns the number of flashes still shown.
+ *
+ * @return size_t The number of flashes.
+ */
+size_t flashLayer::getCount() const
+{
+    return flashes.size();
+} // getCount() const
+
+/**
+ * @brief Draws every flash.
+ *
+ * @param window The window to draw in.
+ */
+void flashLayer::draw(MinGL& window) const
+{
+    for (const flash &current : flashes)
+        window << current.rectangle;
+} // draw(MinGL& window) const
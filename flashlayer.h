@@ -0,0 +1,43 @@
+#ifndef FLASHLAYER_H
+#define FLASHLAYER_H
+
+#include <chrono>
+#include <list>
+#include "mingl/mingl.h"
+#include "mingl/graphics/rect.h"
+#include "mingl/shape/rectangle.h"
+#include "mingl/transition/transition_engine.h"
+
+/**
+ * @brief White flashes fading out over a transition engine, such as the invader kill effects.
+ *
+ * Each flash is a rectangle whose alpha is driven by a fade transition. A flash is only
+ * removed once the destination callback of its fade has run, that is once the engine no
+ * longer writes to it: its alpha reaches 0 before the transition ends, so it cannot be
+ * used to tell when the rectangle can go.
+ */
+class flashLayer
+{
+private:
+    struct flash {
+        nsShape::Rectangle rectangle;
+        bool finished;
+    };
+
+    nsTransition::TransitionEngine &transitions;
+    std::chrono::milliseconds duration;
+    std::list<flash> flashes;
+
+public:
+    flashLayer(nsTransition::TransitionEngine &transitions, const std::chrono::milliseconds &duration);
+    ~flashLayer();
+    flashLayer(const flashLayer&) = delete;
+    flashLayer& operator=(const flashLayer&) = delete;
+
+    void start(const nsGraphics::Rect& bounds);
+    void removeFinished();
+    size_t getCount() const;
+    void draw(MinGL& window) const;
+};
+
+#endif // FLASHLAYER_H
@@ -1,9 +1,12 @@
 #include "game.h"
+#include "assets.h"
 
 /**
  * @brief Constructs a new game object with the specified window name, size, and FPS limit.
  *
  * Initializes the main game window, background, menu screens, and sets the initial game state to Menu.
+ * Only the background and the menu are loaded here: the end screens are only held in memory while
+ * they are shown (see acquireEndScreen()).
  * Also initializes the graphics context, FPS limiter, and sets up menu buttons and other necessary functions.
  *
  * @param name The title of the game window.
@@ -12,12 +15,18 @@
  */
 game::game(string name, nsGraphics::Vec2D windowSize, unsigned int limitFPS)
     : window(name, windowSize, nsGraphics::Vec2D(128, 128), nsGraphics::KBlack)
-    , background("./sprite/background.si2", nsGraphics::Vec2D(0, 0))
-    , gameMenu("./sprite/game-menu.si2", nsGraphics::Vec2D(0, 0))
-    , victoryScreen("./sprite/game-win.si2", nsGraphics::Vec2D(0, 0))
-    , gameOverScreen("./sprite/game-over.si2", nsGraphics::Vec2D(0, 0))
+    , background(assetRegistry::get().getSprite("background"))
+    , gameMenu(assetRegistry::get().getSprite("game-menu"))
+    , screens(endScreenBudget)
+    , backgroundLayer(nsGraphics::Vec2D(0, 0), windowSize)
+    , gameMenuLayer(nsGraphics::Vec2D(0, 0), windowSize)
+    , endScreenLayer(nsGraphics::Vec2D(0, 0), windowSize)
     , state(GameState::Menu)
 {
+    // The full-screen images never change: each one is uploaded into a texture on first use
+    backgroundLayer.addSprite(background);
+    gameMenuLayer.addSprite(gameMenu);
+
     window.initGlut();
     window.initGraphic();
     FPS = new fpsLimiter(limitFPS);
@@ -53,6 +62,43 @@ void game::initFunction(){
     stateFunctions[static_cast<int>(GameState::GameOver)]= &game::showEndScreen;
 } // initFunction()
 
+/**
+ * @brief Starts loading the end screen the game is heading for, while it is still being played.
+ *
+ * The game over screen is prefetched once the invaders come within prefetchDistance of the
+ * game over line, the victory screen once prefetchInvaders invaders or fewer are left. Each
+ * one is prefetched once, so calling this every frame is cheap.
+ */
+void game::prefetchEndScreens() {
+    if (Party->getLowestInvaderY() >= gameOverY - prefetchDistance)
+        screens.prefetch("game-over");
+    if (Party->getInvadersCount() <= prefetchInvaders)
+        screens.prefetch("game-win");
+} // prefetchEndScreens()
+
+/**
+ * @brief Takes the screen of the game's outcome from the residency manager, and drops the other.
+ *
+ * It has normally been prefetched, so this does not wait. Like the other full-screen images, it is
+ * uploaded into a texture on first use.
+ */
+void game::acquireEndScreen() {
+    endScreen = screens.acquire(state == GameState::Victory ? "game-win" : "game-over");
+    screens.dropPrefetched();
+    endScreenLayer.addSprite(*endScreen);
+} // acquireEndScreen()
+
+/**
+ * @brief Releases the end screen and its texture when leaving it, then lets the residency manager
+ * evict it if it does not fit in endScreenBudget.
+ */
+void game::releaseEndScreen() {
+    endScreenLayer.clearSprites();
+    endScreenLayer.releaseTexture();
+    endScreen.reset();
+    screens.trim();
+} // releaseEndScreen()
+
 /**
  * @brief Checks if the game window is currently open.
  *
@@ -66,21 +112,34 @@ bool game::windowIsOpen(){
     return window.isOpen();
 } // windowIsOpen()
 
+/**
+ * @brief Clears the game window before rendering a new frame.
+ */
+void game::windowClear() {
+    window.clearScreen();
+} // windowClear()
+
 /**
  * @brief Executes a single frame of the game loop.
  *
  * This function performs the following steps in order:
- * 1. Clears the game window for rendering a new frame.
- * 2. Invokes the current game state handler via a function pointer.
- * 3. Waits to maintain a consistent frame rate using the FPS controller.
- * 4. Finalizes and displays the rendered frame on the window.
+ * 1. Processes pending input events, which may change the game state.
+ * 2. Invokes the current game state handler via a function pointer. The handler
+ *    clears and draws the window, or reports that nothing changed on screen.
+ * 3. If a frame was drawn, waits to maintain a consistent frame rate using the
+ *    FPS controller, then finalizes and displays the rendered frame.
+ * 4. Otherwise, keeps the previous frame on screen and sleeps until an input
+ *    event arrives or idleTimeout expires.
  */
 void game::playFrame() {
-    window.clearScreen();
-    (this->*stateFunctions[static_cast<int>(state)])();
-
-    FPS->wait();
-    window.finishFrame();
+    processEvents();
+    if ((this->*stateFunctions[static_cast<int>(state)])()) {
+        FPS->wait();
+        window.finishFrame();
+    }
+    else {
+        window.waitEvents(idleTimeout);
+    }
 } // playFrame()
 
 /**
@@ -88,12 +147,12 @@ void game::playFrame() {
  *
  * This function retrieves and handles all events from the window's event manager.
  * It updates the last known mouse position on mouse movement or dragging events.
- * On mouse click events (specifically left mouse button release), it checks if any
- * menu button is under the mouse cursor and triggers its click handler if so.
+ * On mouse click events (specifically left mouse button release), the menu layer
+ * hit-tests the cursor and triggers the click handler of the button under it.
  *
  * Event types handled:
  * - MouseMove / MouseDrag: Updates lastMousePosition.
- * - MouseClick (left button release): Checks for button clicks in menuButtons.
+ * - MouseClick (left button release): Triggers the button of menuLayer under the cursor.
  */
 void game::processEvents() {
     auto& eventManager = window.getEventManager();
@@ -105,50 +164,47 @@ void game::processEvents() {
         if (evt.eventType == nsEvent::MouseClick) {
             if (evt.eventData.clickData.button == 0 && evt.eventData.clickData.state == 0) {
                 nsGraphics::Vec2D mousePos(evt.eventData.clickData.x, evt.eventData.clickData.y);
-                for (auto& btn : menuButtons) {
-                    if (btn.isMouseOver(mousePos)) {
-                        btn.tryClick(mousePos, true);
-                    }
-                }
+                menuLayer.click(mousePos);
             }
         }
     }
 } // processEvents()
 
 /**
- * @brief Updates the hover state of all menu buttons based on the mouse position.
+ * @brief Updates the hover state of the menu buttons based on the mouse position.
  *
- * Iterates through each button in the menuButtons collection and sets its hover state
- * depending on whether the mouse position is over the button.
+ * The menu layer skips the update when the mouse has not moved, and otherwise
+ * only touches the buttons whose hover state actually changes.
  *
  * @param mousePos The current position of the mouse cursor.
  */
 void game::updateMenuButtonsHover(const nsGraphics::Vec2D& mousePos) {
-    for (auto& btn : menuButtons) {
-        btn.setHover(btn.isMouseOver(mousePos));
-    }
+    menuLayer.updateHover(mousePos);
 } // updateMenuButtonsHover(const nsGraphics::Vec2D& mousePos)
 
 /**
  * @brief Initializes the menu buttons for the game menu.
  *
- * This function clears any existing menu buttons and adds a "Start Game" button
- * to the menu. When the "Start Game" button is pressed, the game state is set to
- * Playing, the menu buttons are cleared, and a new Party object is created and
- * initialized with invaders.
+ * This function clears the menu layer and adds a "Start Game" button and the
+ * version label to it. When the "Start Game" button is pressed, the game state
+ * is set to Playing, the menu layer is cleared, and a new Party object is created
+ * and initialized with invaders.
  */
 void game::initMenuButtons() {
-    menuButtons.clear();
-    menuButtons.emplace_back(
+    menuLayer.clear();
+    menuLayer.addButton(
         nsGraphics::Vec2D(375, 350), nsGraphics::Vec2D(90, 16), "Start Game",
         [this]() { 
             state = GameState::Playing; 
-            menuButtons.clear();
+            menuLayer.clear();
+            delete Party;
             Party = new party(window);
             Party->createInvaders();
+            lastFrameTime = std::chrono::steady_clock::now();
         },
         nsGui::GlutFont::GlutFonts::BITMAP_HELVETICA_18
         );
+    menuLayer.addLabel(nsGui::Text(nsGraphics::Vec2D(10, 580), "Version: 1.0", nsGraphics::KWhite, nsGui::GlutFont::BITMAP_HELVETICA_12));
 }
 
 /**
@@ -159,11 +215,12 @@ void game::initMenuButtons() {
  * The button is positioned at (375, 400) with a size of (110, 16) and uses the BITMAP_HELVETICA_18 font.
  */
 void game::initReturnMenuButton() {
-    menuButtons.clear();
-    menuButtons.emplace_back(
+    menuLayer.clear();
+    menuLayer.addButton(
         nsGraphics::Vec2D(375, 400), nsGraphics::Vec2D(110, 16), "Back to menu",
         [this]() {
             state = GameState::Menu;
+            releaseEndScreen();
             initMenuButtons();
         },
         nsGui::GlutFont::GlutFonts::BITMAP_HELVETICA_18
@@ -173,20 +230,24 @@ void game::initReturnMenuButton() {
 /**
  * @brief Displays and manages the main menu of the game.
  *
- * This function processes user input events, updates the hover state of menu buttons
+ * This function updates the hover state of menu buttons
  * based on the current mouse position, and renders the main menu interface.
- * It draws all menu buttons and displays the game version information on the window.
+ * The menu layer holds the buttons and the game version label.
+ *
+ * @return false if nothing changed since the last drawn frame, in which case nothing is drawn.
  */
-void game::mainMenu(){
-    processEvents();
+bool game::mainMenu(){
     nsGraphics::Vec2D mousePos = lastMousePosition;
     updateMenuButtonsHover(mousePos);
 
-    window << gameMenu;
-    for (const auto& btn : menuButtons)
-        btn.draw(window);
+    if (!menuLayer.isDirty() && !window.needsRedraw() && drawnState == state)
+        return false;
 
-    window << nsGui::Text(nsGraphics::Vec2D(10, 580), "Version: 1.0", nsGraphics::KWhite, nsGui::GlutFont::BITMAP_HELVETICA_12);
+    drawnState = state;
+    windowClear();
+    window << gameMenuLayer;
+    menuLayer.draw(window);
+    return true;
 } // mainMenu()
 
 /**
@@ -196,42 +257,75 @@ void game::mainMenu(){
  * and checking for game over or victory conditions. If all invaders are defeated,
  * the game state transitions to Victory. If any invader reaches the bottom threshold,
  * the game state transitions to GameOver. In both cases, the invader party is deleted
- * and the return-to-menu button is initialized.
+ * and the return-to-menu button is initialized. While the game goes on, the end screen it is
+ * heading for is prefetched, so that the transition does not wait for it.
+ *
+ * The party is advanced by the real time elapsed since the previous frame, so its
+ * movement speed does not depend on the frame rate.
+ *
+ * @return true, as the game scene changes every frame.
  */
-void game::playGame(){
-    window << background;
-    Party->play();
-    if (Party->getLowestInvaderY() >= 490) {
-        state = GameState::GameOver;
-        delete Party;
-        initReturnMenuButton();
-    }
+bool game::playGame(){
+    drawnState = state;
+    windowClear();
+    window << backgroundLayer;
+    Party->play(measureFrameDelta());
 
-    if (Party->getInvadersCount() == 0) {
+    if (Party->getLowestInvaderY() >= gameOverY)
+        state = GameState::GameOver;
+    else if (Party->getInvadersCount() == 0)
         state = GameState::Victory;
-        delete Party;
-        initReturnMenuButton();
+    else {
+        prefetchEndScreens();
+        return true;
     }
+
+    delete Party;
+    Party = nullptr;
+    acquireEndScreen();
+    initReturnMenuButton();
+    return true;
 } // playGame()
 
+/**
+ * @brief Measures the time elapsed since the previous call.
+ *
+ * The result is clamped to maxFrameDelta, so that a stall (window dragged, debugger break)
+ * does not make the invaders jump across the screen.
+ *
+ * @return The elapsed time, at most maxFrameDelta.
+ */
+std::chrono::microseconds game::measureFrameDelta() {
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::chrono::microseconds delta = std::chrono::duration_cast<std::chrono::microseconds>(now - lastFrameTime);
+    lastFrameTime = now;
+    return std::min<std::chrono::microseconds>(delta, maxFrameDelta);
+} // measureFrameDelta()
+
 /**
  * @brief Displays the end screen (victory or game over) and handles menu button interactions.
  *
- * This function processes user input events, updates the hover state of menu buttons
+ * This function updates the hover state of menu buttons
  * based on the current mouse position, and renders the appropriate end screen
  * (victory or game over) along with the menu buttons.
  *
- * The function assumes that `processEvents()`, `updateMenuButtonsHover()`, and
- * the rendering of screens and buttons are handled elsewhere in the class.
+ * The function assumes that `processEvents()` has already run for this frame, and that
+ * `updateMenuButtonsHover()` and the rendering of screens and buttons are handled elsewhere in the class.
+ *
+ * @return false if nothing changed since the last drawn frame, in which case nothing is drawn.
  */
-void game::showEndScreen() {
-    processEvents();
+bool game::showEndScreen() {
     nsGraphics::Vec2D mousePos = lastMousePosition;
     updateMenuButtonsHover(mousePos);
 
-    window << (state == GameState::Victory ? victoryScreen : gameOverScreen);
-    for (const auto& btn : menuButtons)
-        btn.draw(window);
+    if (!menuLayer.isDirty() && !window.needsRedraw() && drawnState == state)
+        return false;
+
+    drawnState = state;
+    windowClear();
+    window << endScreenLayer;
+    menuLayer.draw(window);
+    return true;
 } // showEndScreen()
 
 
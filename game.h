@@ -1,13 +1,16 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <chrono>
 #include <string>
 #include "party.h"
-#include "button.h"
+#include "assetresidency.h"
+#include "uilayer.h"
 #include "fpslimiter.h"
 #include "mingl/mingl.h"
 #include "mingl/gui/text.h"
 #include "mingl/gui/sprite.h"
+#include "mingl/graphics/cachedlayer.h"
 #include "mingl/event/event_manager.h"
 
 #include <vector>
@@ -26,30 +29,48 @@ private:
     };
 
     MinGL window;
-    party *Party;
+    party *Party = nullptr;
     fpsLimiter *FPS = nullptr;
     nsGui::Sprite background;
     nsGui::Sprite gameMenu;
-    nsGui::Sprite victoryScreen;
-    nsGui::Sprite gameOverScreen;
+    assetResidency screens;
+    std::shared_ptr<const nsGui::Sprite> endScreen;
+    nsGraphics::CachedLayer backgroundLayer;
+    nsGraphics::CachedLayer gameMenuLayer;
+    nsGraphics::CachedLayer endScreenLayer;
     GameState state;
-    vector<Button> menuButtons;
+    GameState drawnState = GameState::Count;
+    UiLayer menuLayer;
 
 
-    void (game::*stateFunctions[static_cast<int>(GameState::Count)])();
+    // The end screens are shown once per game: keeping one resident would cost 2 MB during the next game
+    static const size_t endScreenBudget = 0;
+    const int gameOverY = 490;
+    const int prefetchDistance = 60;
+    const int prefetchInvaders = 5;
+
+    const std::chrono::milliseconds idleTimeout = std::chrono::milliseconds(500);
+    const std::chrono::milliseconds maxFrameDelta = std::chrono::milliseconds(100);
+    std::chrono::steady_clock::time_point lastFrameTime;
+
+    bool (game::*stateFunctions[static_cast<int>(GameState::Count)])();
     void windowClear();
     nsGraphics::Vec2D lastMousePosition = nsGraphics::Vec2D(0, 0);
 
     void initFunction();
+    void prefetchEndScreens();
+    void acquireEndScreen();
+    void releaseEndScreen();
 
 public:
     game(string name, nsGraphics::Vec2D windowSize, unsigned int limitFPS);
     ~game();
 
     bool windowIsOpen();
-    void mainMenu();
-    void playGame();
-    void showEndScreen();
+    std::chrono::microseconds measureFrameDelta();
+    bool mainMenu();
+    bool playGame();
+    bool showEndScreen();
     void playFrame();
     void updateMenuButtonsHover(const nsGraphics::Vec2D& mousePos);
     void initMenuButtons();
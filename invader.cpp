@@ -1,24 +1,19 @@
 #include "invader.h"
 
 invader::invader(const nsGraphics::Vec2D& coords, const nsGui::Sprite& sprite)
-    : entity(coords, sprite) {}
+    : entity(coords, sprite), home(coords) {}
 
-nsGraphics::Vec2D invader::getPosition() const
+nsGraphics::Vec2D invader::getHome() const
 {
-    return sprite.getPosition();
+    return home;
 }
 
 nsGraphics::Vec2D invader::getPosition(int direction) const
 {
     int size = (direction == 1) ? sprite.computeSize().getX() : 0;
-    return sprite.getPosition() + nsGraphics::Vec2D(size, 0);
-}
-
-bool invader::isColliding(nsGraphics::Vec2D firstCorner, nsGraphics::Vec2D secondCorner)
-{
-    return sprite.getPosition().isColliding(firstCorner, secondCorner);
+    return getPosition() + nsGraphics::Vec2D(size, 0);
 }
 
 void invader::move(const nsGraphics::Vec2D& delta) {
-    sprite.setPosition(sprite.getPosition() + delta);
+    setPosition(getExactPosition() + nsGraphics::Vec2F(delta));
 }
\ No newline at end of file
@@ -7,13 +7,14 @@ class invader : public entity
 {
 private:
     //uint8_t health;
+    nsGraphics::Vec2D home;
 
 public:
     invader(const nsGraphics::Vec2D& pos, const nsGui::Sprite& sprite);
     virtual ~invader() = default;
-    nsGraphics::Vec2D getPosition() const;
+    nsGraphics::Vec2D getHome() const;
+    using entity::getPosition;
     nsGraphics::Vec2D getPosition(int direction) const;
-    bool isColliding(nsGraphics::Vec2D firstCorner, nsGraphics::Vec2D secondCorner);
     void move(const nsGraphics::Vec2D& delta);
 };
 
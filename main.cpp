@@ -1,8 +1,24 @@
+#include <algorithm>
+#include <thread>
 #include <game.h>
+#include "assets.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 using namespace std;
 
 int main(){
+#ifdef __GLIBC__
+    // Full-screen images are allocated and freed as they are shown (see assetResidency): a fixed
+    // threshold keeps them in their own mappings, which are given back on free instead of staying in the heap
+    mallopt(M_MMAP_THRESHOLD, 256 * 1024);
+#endif
+
+    // The first screens load on a small thread pool; the end screens are fetched during the game
+    assetRegistry::get().preload(assetRegistry::startupSprites, std::min(4u, std::max(1u, std::thread::hardware_concurrency())));
+
     game *Game = new game("Space Invader", nsGraphics::Vec2D(830, 590), 30);
 
     while (Game->windowIsOpen()){
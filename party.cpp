@@ -1,25 +1,44 @@
 #include "party.h"
+#include "assets.h"
+
+#ifdef SPACE_INVADER_PROFILE
+#include <iostream>
+#endif
 
 /**
  * @brief Constructs a party object with the specified window and window size.
  */
-party::party(MinGL &window) : window(window)
+party::party(MinGL &window)
+    : window(window)
+    , killFlashes(transitions, killFlashDuration)
+    , fadeOverlay(nsGraphics::Vec2D(0, 0), window.getWindowSize(), nsGraphics::KBlack)
 {
-    windowLenght = window.getWindowSize().getX();
+    nsGraphics::Vec2D windowSize = window.getWindowSize();
+    windowLenght = windowSize.getX();
     Player = new player(nsGraphics::Vec2D(0, 0), nsGraphics::Vec2D(0, windowLenght));
-    int playerX = (window.getWindowSize().getX() - Player->computeSize().getX() / 2) / 2;
-    int playerY = window.getWindowSize().getY() - Player->computeSize().getY();
-    Player->entity::setPosition(nsGraphics::Vec2D(playerX, playerY));
+    int playerX = (windowSize.getX() - Player->computeSize().getX() / 2) / 2;
+    int playerY = windowSize.getY() - Player->computeSize().getY();
+    Player->setPosition(nsGraphics::Vec2D(playerX, playerY));
+
+    // The party fades in from black
+    transitions.startContract(nsTransition::TransitionContract(
+        fadeOverlay, nsShape::Rectangle::TRANSITION_FILL_COLOR_ALPHA, fadeInDuration, {0.f}));
 } // party(MinGL &window, int windowSize)
 
+party::~party()
+{
+    delete Player;
+    Player = nullptr;
+} // ~party()
+
 /**
  * @brief Initializes and populates the invaders grid for the party.
  *
  * This function clears any existing invaders and creates a 3-row formation of invaders,
  * each row using a different sprite. Each row contains 6 invaders, positioned with
  * specific x and y coordinates. The invaders are spaced horizontally by 80 units,
- * and vertically by 60 units between rows. The sprites for each row are loaded from
- * predefined file paths.
+ * and vertically by 60 units between rows. The sprites for each row are views on the
+ * game's sprite atlas, so that the invaders share their pixels instead of each loading a file.
  *
  * The invaders are stored in the 'invaders' member variable, which is a vector of vectors.
  */
@@ -28,9 +47,9 @@ void party::createInvaders()
     invaders.clear();
     invaders.resize(3);
     const char *sprites[3] = {
-        "./sprite/invader-1.si2",
-        "./sprite/invader-2.si2",
-        "./sprite/invader-3.si2"};
+        "invader-1",
+        "invader-2",
+        "invader-3"};
 
     int x = 10;
     int y = 10;
@@ -39,7 +58,7 @@ void party::createInvaders()
         invaders[i].clear();
         for (size_t j = 0; j < 6; ++j)
         {
-            invaders[i].emplace_back(nsGraphics::Vec2D(x, y), nsGui::Sprite(sprites[i]));
+            invaders[i].emplace_back(nsGraphics::Vec2D(x, y), assetRegistry::get().getAtlasSprite(sprites[i]));
             x += 80;
             if (x > 410)
                 x = 10;
@@ -47,6 +66,11 @@ void party::createInvaders()
         x = 10;
         y += 60;
     }
+
+    formationOffset = nsGraphics::Vec2F();
+    formationDescending = false;
+    direction = 1;
+    startFormationLeg();
 } // createInvaders()
 
 /**
@@ -54,17 +78,72 @@ void party::createInvaders()
  *
  * This function performs the following actions in order:
  * 1. Handles the logic for eliminating invaders.
- * 2. Draws the current state of all invaders on the screen.
- * 3. Updates the movement of all invaders.
+ * 2. Advances the formation, then the transitions (kill flashes, fade-in), by the measured frame time.
+ * 3. Draws the current state of all invaders on the screen, then the effects on top.
  * 4. Updates the movement of the player.
+ *
+ * @param delta The time elapsed since the previous frame.
  */
-void party::play()
+void party::play(const std::chrono::microseconds& delta)
 {
     killInvader();
+    updateFormation(delta);
+    updateTransitions(delta);
+    updatePlayerMovement(delta);
     drawInvaders();
-    updateInvadersMovement();
-    updatePlayerMovement();
-} // play()
+    drawEffects();
+} // play(const std::chrono::microseconds& delta)
+
+/**
+ * @brief Advances every transition of the party by the given frame time.
+ *
+ * When SPACE_INVADER_PROFILE is defined, the cost of the engine update is accumulated
+ * and reported to std::clog about once per second.
+ *
+ * @param delta The time elapsed since the previous frame.
+ */
+void party::updateTransitions(const std::chrono::microseconds& delta)
+{
+#ifdef SPACE_INVADER_PROFILE
+    const auto start = std::chrono::steady_clock::now();
+#endif
+
+    transitions.update(delta);
+
+#ifdef SPACE_INVADER_PROFILE
+    const auto end = std::chrono::steady_clock::now();
+    const auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    profileEngineTime += cost;
+    profileEngineMax = std::max(profileEngineMax, cost);
+    ++profileFrames;
+
+    if (end - profileLastReport >= std::chrono::seconds(1))
+    {
+        std::clog << "[profile] transition engine: "
+                  << transitions.getTransitionCount() << " transitions, "
+                  << profileEngineTime.count() / 1000.0 / profileFrames << " us/frame avg, "
+                  << profileEngineMax.count() / 1000.0 << " us max over "
+                  << profileFrames << " frames" << std::endl;
+        profileEngineTime = std::chrono::nanoseconds::zero();
+        profileEngineMax = std::chrono::nanoseconds::zero();
+        profileFrames = 0;
+        profileLastReport = end;
+    }
+#endif
+
+    // Only flashes whose fade has ended can go: the engine no longer refers to them
+    killFlashes.removeFinished();
+} // updateTransitions(const std::chrono::microseconds& delta)
+
+/**
+ * @brief Draws the kill flashes over the invaders, then the fade-in overlay while it is visible.
+ */
+void party::drawEffects()
+{
+    killFlashes.draw(window);
+    if (fadeOverlay.getFillColor().getAlpha() != 0)
+        window << fadeOverlay;
+} // drawEffects()
 
 /**
  * @brief Draws all invaders and the player onto the game window.
@@ -136,76 +215,126 @@ int party::getLowestInvaderY() const
 } // getLowestInvaderY()
 
 /**
- * @brief Updates the movement of the invaders based on their current direction and position.
+ * @brief Starts the next leg of the formation movement from the current formation offset.
  *
- * This function checks the current bounds of the invaders and determines if they have reached
- * the edge of the window. If so, it moves all invaders down by a step and reverses their direction.
- * Otherwise, it moves the invaders horizontally in the current direction.
- *
- * Preconditions:
- * - The invaders' positions and movement parameters (direction, stepX, stepY, windowLenght) are properly initialized.
- *
- * Postconditions:
- * - Invaders are moved either horizontally or vertically, and direction may be reversed if an edge is reached.
+ * The formation alternates between two kinds of legs, both played at formationSpeed pixels per second:
+ * - A horizontal sweep, from the current position to the edge of the window in the current direction.
+ * - A descent of stepY pixels, after which the direction is reversed.
+ * The leg is stepped by updateFormation() on the simulated clock, in fixed point, so that the formation
+ * follows the same path whatever the frame rate, the compiler or the floating-point options.
  */
-void party::updateInvadersMovement()
+void party::startFormationLeg()
 {
-    auto [minX, maxX] = getInvadersBounds();
-    if ((direction == 1 && maxX + stepX > windowLenght) ||
-        (direction == -1 && minX - stepX < 0))
+    legStart = formationOffset;
+    legDestination = formationOffset;
+    legElapsed = std::chrono::microseconds::zero();
+    legDuration = std::chrono::microseconds::zero();
+    if (getInvadersCount() == 0)
+        return;
+
+    int distance;
+    if (formationDescending)
     {
-        moveInvaders(nsGraphics::Vec2D(0, stepY));
-        direction *= -1;
+        distance = stepY;
+        legDestination += nsGraphics::Vec2F(0, distance);
     }
     else
-        moveInvaders(nsGraphics::Vec2D(stepX * direction, 0));
+    {
+        auto [minX, maxX] = getInvadersBounds();
+        distance = (direction == 1) ? windowLenght - maxX : minX;
+        if (distance <= 0)
+        {
+            // Already against the edge, go straight down
+            formationDescending = true;
+            startFormationLeg();
+            return;
+        }
+        legDestination += nsGraphics::Vec2F(distance * direction, 0);
+    }
 
-} // updateInvadersMovement()
+    // Rounded up, so that even the shortest leg lasts and updateFormation() always moves forward
+    legDuration = std::chrono::microseconds((distance * 1000000LL + formationSpeed - 1) / formationSpeed);
+} // startFormationLeg()
 
 /**
- * @brief Moves all invaders in the party by a specified delta.
+ * @brief Advances the formation along its legs by the given simulated time.
  *
- * Iterates through each invader in the 2D invaders collection and applies
- * the given movement vector to update their positions.
+ * A leg that ends during the frame starts the next one, which receives the rest of the frame time.
+ * The offset between the two ends of a leg is interpolated with an integer ratio of elapsed time.
  *
- * @param delta The vector by which to move each invader.
+ * @param delta The time elapsed since the previous frame.
  */
-void party::moveInvaders(nsGraphics::Vec2D delta)
+void party::updateFormation(const std::chrono::microseconds& delta)
+{
+    if (legDuration == std::chrono::microseconds::zero())
+        return;
+
+    legElapsed += delta;
+    while (legDuration != std::chrono::microseconds::zero() && legElapsed >= legDuration)
+    {
+        const std::chrono::microseconds overflow = legElapsed - legDuration;
+        formationOffset = legDestination;
+        applyFormationOffset();
+
+        if (formationDescending)
+            direction *= -1;
+        formationDescending = !formationDescending;
+        startFormationLeg();
+        legElapsed = overflow;
+    }
+
+    typedef nsGraphics::Vec2F::Scalar_t Scalar_t;
+    if (legDuration != std::chrono::microseconds::zero())
+        formationOffset = legStart + (legDestination - legStart)
+            * nsGraphics::scalarFromRatio<Scalar_t>(legElapsed.count(), legDuration.count());
+    applyFormationOffset();
+} // updateFormation(const std::chrono::microseconds& delta)
+
+/**
+ * @brief Moves every invader to its home position shifted by the current formation offset.
+ *
+ * The offset keeps its sub-pixel part: the invaders are only rounded to whole pixels when drawn.
+ */
+void party::applyFormationOffset()
 {
     for (auto &row : invaders)
     {
         for (auto &inv : row)
         {
-            inv.move(delta);
+            inv.setPosition(nsGraphics::Vec2F(inv.getHome()) + formationOffset);
         }
     }
-} // moveInvaders(nsGraphics::Vec2D delta)
+} // applyFormationOffset()
 
 /**
- * @brief Sets the player's position based on the given delta and direction.
+ * @brief Moves the player by the given delta.
  *
- * This function updates the player's position by applying the specified delta vector
- * and direction. It delegates the actual position update to the Player object's setPosition method.
+ * This function updates the player's position by applying the specified delta vector.
+ * It delegates the actual position update to the Player object's move method.
  *
- * @param delta The change in position as a 2D vector.
- * @param direction The direction in which to move the player.
+ * @param delta The change in position as a sub-pixel 2D vector.
  */
-void party::setPlayerPosition(const nsGraphics::Vec2D &delta)
+void party::movePlayer(const nsGraphics::Vec2F &delta)
 {
-    Player->setPosition(delta);
-} // setPlayerPosition(const nsGraphics::Vec2D &delta, int direction)
+    Player->move(delta);
+} // movePlayer(const nsGraphics::Vec2F &delta)
 
 /**
- * @brief Updates the player's movement based on the currently pressed key.
+ * @brief Updates the player's simulation and movement based on the currently pressed key.
  *
- * This function checks which key is pressed and performs the corresponding action:
+ * The player is first advanced by delta (shot cooldown and bullets), then this function
+ * checks which key is pressed and performs the corresponding action:
  * - If '0' is pressed, the function returns immediately.
  * - If the "up" key (KUp) is pressed, the player shoots (currently only returns).
  * - If the pressed key corresponds to a movement direction (found in keyToDirection),
- *   the player's position is updated accordingly.
+ *   the player moves along it at playerSpeed pixels per second.
+ *
+ * @param delta The time elapsed since the previous frame.
  */
-void party::updatePlayerMovement()
+void party::updatePlayerMovement(const std::chrono::microseconds& delta)
 {
+    Player->update(delta);
+
     char key = getPressedKey();
 
     if (key == '0')
@@ -220,9 +349,11 @@ void party::updatePlayerMovement()
     auto it = keyToDirection.find(key);
     if (it != keyToDirection.end())
     {
-        setPlayerPosition(it->second);
+        typedef nsGraphics::Vec2F::Scalar_t Scalar_t;
+        const Scalar_t seconds = nsGraphics::scalarFromRatio<Scalar_t>(delta.count(), 1000000);
+        movePlayer(it->second * (Scalar_t(playerSpeed) * seconds));
     }
-} // updatePlayerMovement()
+} // updatePlayerMovement(const std::chrono::microseconds& delta)
 
 /**
  * @brief Returns the key currently pressed by the user, or 0 if none.
@@ -246,19 +377,26 @@ char party::getPressedKey() const
  * @brief Removes invaders that have been hit by the player.
  *
  * Iterates through all rows of invaders and checks each invader to determine
- * if it has been hit by the player. If an invader is hit, it is removed from
- * its respective row. This function modifies the invaders container in place.
+ * if it has been hit by the player. If an invader is hit, a kill flash is started
+ * at its position and it is removed from its respective row. This function
+ * modifies the invaders container in place.
+ *
+ * Removing an invader may move the edge of the formation, so the current horizontal
+ * leg is then stopped where it is and restarted towards the new edge.
  */
 void party::killInvader()
 {
+    bool killed = false;
     for (auto &row : invaders)
     {
         auto it = row.begin();
         while (it != row.end())
         {
-            if (Player->isInvaderHit(it->getSprite()))
+            if (Player->isInvaderHit(*it))
             {
+                startKillFlash(*it);
                 it = row.erase(it);
+                killed = true;
             }
             else
             {
@@ -266,8 +404,21 @@ void party::killInvader()
             }
         }
     }
+
+    if (killed && !formationDescending)
+        startFormationLeg();
 } // killInvader() const
 
+/**
+ * @brief Starts a white flash fading out over the given invader.
+ *
+ * @param inv The invader that has just been killed.
+ */
+void party::startKillFlash(const invader& inv)
+{
+    killFlashes.start(inv.getBounds());
+} // startKillFlash(const invader& inv)
+
 /**
  * @brief Returns the total number of invaders in the party.
  *
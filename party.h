@@ -1,13 +1,18 @@
 #ifndef PARTY_H
 #define PARTY_H
 
+#include <chrono>
 #include <limits>
+#include <list>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
 #include "invader.h"
 #include "player.h"
+#include "flashlayer.h"
 #include "mingl/mingl.h"
+#include "mingl/shape/rectangle.h"
+#include "mingl/transition/transition_engine.h"
 
 using namespace std;
 
@@ -19,33 +24,60 @@ private:
     player *Player;
     int direction = 1;
     int windowLenght;
-    const int stepX = 10;
     const int stepY = 20;
+    const int formationSpeed = 300; // pixels per second
+    const int playerSpeed = 150; // pixels per second
+    const std::chrono::milliseconds killFlashDuration = std::chrono::milliseconds(250);
+    const std::chrono::milliseconds fadeInDuration = std::chrono::milliseconds(400);
     const char KUp = 'z';
     const char KLeft = 'q';
     const char KRight = 'd';
 
-    std::unordered_map<char, nsGraphics::Vec2D> keyToDirection = {
-        {KLeft, nsGraphics::Vec2D(-5, 0)},
-        {KRight, nsGraphics::Vec2D(5, 0)},
+    nsTransition::TransitionEngine transitions;
+    nsGraphics::Vec2F formationOffset;
+    nsGraphics::Vec2F legStart;
+    nsGraphics::Vec2F legDestination;
+    std::chrono::microseconds legDuration = std::chrono::microseconds::zero();
+    std::chrono::microseconds legElapsed = std::chrono::microseconds::zero();
+    bool formationDescending = false;
+    flashLayer killFlashes;
+    nsShape::Rectangle fadeOverlay;
+
+#ifdef SPACE_INVADER_PROFILE
+    std::chrono::nanoseconds profileEngineTime = std::chrono::nanoseconds::zero();
+    std::chrono::nanoseconds profileEngineMax = std::chrono::nanoseconds::zero();
+    unsigned profileFrames = 0;
+    std::chrono::steady_clock::time_point profileLastReport = std::chrono::steady_clock::now();
+#endif
+
+    std::unordered_map<char, nsGraphics::Vec2F> keyToDirection = {
+        {KLeft, nsGraphics::Vec2F(-1, 0)},
+        {KRight, nsGraphics::Vec2F(1, 0)},
     };
+
+    void startFormationLeg();
+    void updateFormation(const std::chrono::microseconds& delta);
+    void applyFormationOffset();
+    void startKillFlash(const invader& inv);
+    void updateTransitions(const std::chrono::microseconds& delta);
+    void drawEffects();
+
 public:
 
     party(MinGL &window);
+    ~party();
 
     void createInvaders();
     void drawInvaders();
-    void moveInvaders(nsGraphics::Vec2D delta);
-    void updateInvadersMovement();
     void killInvader();
     std::pair<int, int> getInvadersBounds() const;
     int getLowestInvaderY() const;
     char getPressedKey() const;
     int getInvadersCount() const;
 
-    void updatePlayerMovement();
-    void setPlayerPosition(const nsGraphics::Vec2D& delta);
+    void updatePlayerMovement(const std::chrono::microseconds& delta);
+    void movePlayer(const nsGraphics::Vec2F& delta);
 
-    void play();
+    void play(const std::chrono::microseconds& delta);
 };
 #endif // PARTY_H
@@ -1,67 +1,81 @@
 #include "player.h"
+#include "assets.h"
 
 player::player(nsGraphics::Vec2D coords, nsGraphics::Vec2D limit) :
-    entity (coords, nsGui::Sprite("./sprite/vessel.si2")), limit(limit) {}
+    entity (coords, assetRegistry::get().getAtlasSprite("vessel")), limit(limit) {}
 
 /**
- * @brief Sets the player's position based on a delta vector and movement direction.
+ * @brief Moves the player by a delta vector.
  *
  * This function calculates the new position of the player by adding the specified delta
- * and an optional size offset (depending on the direction) to the current position.
- * It ensures that the new position does not exceed the defined horizontal limits.
- * If the new position is within bounds, the player's position is updated.
+ * to the current position. It ensures that the new position does not exceed the defined
+ * horizontal limits. If the new position is within bounds, the player's position is updated.
  *
- * @param delta The vector by which to move the player.
- * @param direction The movement direction (1 for right, -1 for left). Defaults to 1.
+ * @param delta The sub-pixel vector by which to move the player.
  */
-void player::setPosition(const nsGraphics::Vec2D& delta) {
-    nsGraphics::Vec2D position = entity::getPosition();
-    nsGraphics::Vec2D newPosition = position + delta;
+void player::move(const nsGraphics::Vec2F& delta) {
+    typedef nsGraphics::Vec2F::Scalar_t Scalar_t;
+    nsGraphics::Vec2F newPosition = entity::getExactPosition() + delta;
 
-    if (newPosition.getX() < limit.getX() || (newPosition.getX() + entity::computeSize().getX()) > limit.getY())
+    if (newPosition.getX() < Scalar_t(limit.getX())
+        || (newPosition.getX() + Scalar_t(entity::computeSize().getX())) > Scalar_t(limit.getY()))
         return;
 
-    entity::setPosition(newPosition);
-} // setPosition(const nsGraphics::Vec2D& delta, int direction)
+    setPosition(newPosition);
+} // move(const nsGraphics::Vec2F& delta)
+
+/**
+ * @brief Advances the player's simulation by the given time.
+ *
+ * Counts down the shot cooldown, moves every bullet and removes the ones
+ * that left the screen.
+ *
+ * @param delta The simulated time elapsed since the previous update.
+ */
+void player::update(const std::chrono::microseconds& delta) {
+    // Capped so that a long pause cannot overflow the counter
+    sinceLastShot = std::min<std::chrono::microseconds>(sinceLastShot + delta, shotInterval);
+
+    for (auto& bullet : bullets)
+        bullet.move(delta);
+    removeOffscreenBullets();
+} // update(const std::chrono::microseconds& delta)
 
 /**
  * @brief Determines if the player is allowed to shoot a new bullet.
  *
  * This function checks two conditions:
- * 1. At least 0.5 seconds have passed since the last bullet was shot.
+ * 1. At least shotInterval of simulated time has passed since the last bullet was shot.
  * 2. The current number of bullets is less than or equal to the maximum allowed bullets.
  *
  * @return true if the player can shoot a new bullet, false otherwise.
  */
 bool player::canShoot() const {
-    return (difftime(time(nullptr), lastBulletShot) >= 0.5 && (const int)bullets.size() <= maxBullets) ? true : false;
+    return (sinceLastShot >= shotInterval && (const int)bullets.size() <= maxBullets) ? true : false;
 } // canShoot()
 
 void player::shoot() {
     if (!canShoot()) return;
 
-    lastBulletShot = time(nullptr);
+    sinceLastShot = std::chrono::microseconds::zero();
     bullets.emplace_back(getPosition() + nsGraphics::Vec2D(0, -10));
 } // shoot()
 
 void player::draw(MinGL& window) {
     entity::draw(window);
-    removeOffscreenBullets();
-    for (auto& bullet : bullets) {
+    for (auto& bullet : bullets)
         bullet.draw(window);
-        bullet.move();
-    }    
 } // draw(MinGL& window)
 
-bool player::isInvaderHit(const nsGui::Sprite& invaderSprite) {
+bool player::isInvaderHit(const entity& target) {
     for (auto it = bullets.begin(); it != bullets.end(); ++it) {
-        if (it->isColliding(invaderSprite)) {
+        if (it->isColliding(target)) {
             bullets.erase(it);
             return true;
         }
     }
     return false;
-} // isInvaderHit(const nsGui::Sprite& invaderSprite) const
+} // isInvaderHit(const entity& target)
 
 void player::removeOffscreenBullets() {
     bullets.erase(remove_if(bullets.begin(), bullets.end(),
@@ -1,6 +1,7 @@
 #ifndef PLAYER_H
 #define PLAYER_H
 
+#include <chrono>
 #include <vector>
 #include <algorithm>
 #include "entity.h"
@@ -12,14 +13,16 @@ class player : public entity
 {
 private:
     nsGraphics::Vec2D limit;
-    time_t lastBulletShot = 0;
+    const std::chrono::milliseconds shotInterval = std::chrono::milliseconds(500);
+    std::chrono::microseconds sinceLastShot = shotInterval;
     int maxBullets = 10;
     vector<bullet> bullets;
 public:
     player(nsGraphics::Vec2D coords, nsGraphics::Vec2D limit = nsGraphics::Vec2D(0, 830));
-    void setPosition(const nsGraphics::Vec2D& delta);
+    void move(const nsGraphics::Vec2F& delta);
+    void update(const std::chrono::microseconds& delta);
     bool canShoot() const;
-    bool isInvaderHit(const nsGui::Sprite& invaderSprite);
+    bool isInvaderHit(const entity& target);
     void shoot();
     void draw(MinGL& window) override;
     void removeOffscreenBullets();
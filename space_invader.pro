@@ -1,27 +1,56 @@
 TEMPLATE = app
-CONFIG += console c++17
+CONFIG += console c++17 thread
 CONFIG -= app_bundle
 CONFIG -= qt
 
 include(./MinGL2/mingl.pri)
 
+# make bundle : packs sprite/ into assets.bundle, next to the executable
+bundle.commands = python3 $$PWD/MinGL2/tools/si2bundle.py $$PWD/sprite $$OUT_PWD/assets.bundle
+QMAKE_EXTRA_TARGETS += bundle
+
+# qmake CONFIG+=embed_sprites : compiles sprite/ into the executable, which then opens no file at startup
+embed_sprites {
+    DEFINES += SPACE_INVADER_EMBEDDED_SPRITES
+    embedded_sprites.target = $$OUT_PWD/embedded_sprites.cpp
+    embedded_sprites.commands = python3 $$PWD/MinGL2/tools/si2embed.py -s embeddedSprites $$PWD/sprite $$OUT_PWD/embedded_sprites.cpp
+    embedded_sprites.depends = $$files($$PWD/sprite/*)
+    QMAKE_EXTRA_TARGETS += embedded_sprites
+    PRE_TARGETDEPS += $$OUT_PWD/embedded_sprites.cpp
+    GENERATED_SOURCES += $$OUT_PWD/embedded_sprites.cpp
+}
+
+# qmake CONFIG+=profile : reports the cost of the transition engine on std::clog
+profile {
+    DEFINES += SPACE_INVADER_PROFILE
+}
+
 SOURCES += \
+    assetresidency.cpp \
+    assets.cpp \
     bullet.cpp \
     button.cpp \
     entity.cpp \
+    flashlayer.cpp \
     fpslimiter.cpp \
     game.cpp \
     invader.cpp \
     main.cpp \
     party.cpp \
-    player.cpp
+    player.cpp \
+    uilayer.cpp
 
 HEADERS += \
+    assetresidency.h \
+    assets.h \
     bullet.h \
+    embedded_sprites.h \
     button.h \
     entity.h \
+    flashlayer.h \
     fpslimiter.h \
     game.h \
     invader.h \
     party.h \
-    player.h
+    player.h \
+    uilayer.h
@@ -0,0 +1,16 @@
+TEMPLATE = app
+CONFIG += console c++17 no_sfml thread
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../MinGL2/mingl.pri)
+
+INCLUDEPATH += $$PWD/../..
+
+# The images are read from the sprite/ directory of the game
+DEFINES += "GAME_DIRECTORY=\\\"$$PWD/../..\\\""
+
+SOURCES += \
+    $$PWD/../../assetresidency.cpp \
+    $$PWD/../../assets.cpp \
+    tst_asset_residency.cpp
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <unistd.h>
+#include "assetresidency.h"
+
+// Acquires and releases the end screens under small budgets, and checks which ones stay resident and how many bytes
+// are counted. The screens are loaded from sprite/ without any window.
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char *what)
+{
+    if (condition)
+        return;
+
+    std::cerr << "FAILED: " << what << std::endl;
+    ++failures;
+}
+
+// The screens all have the size of the window
+size_t screenBytes = 0;
+
+void testResidentAndEvictedBytes()
+{
+    assetResidency residency(2 * screenBytes);
+    residency.acquire("background");
+    residency.acquire("game-menu");
+    check(residency.getResidentBytes() == 2 * screenBytes, "two released screens fit in the budget");
+    check(residency.getEvictedBytes() == 0, "nothing is evicted within the budget");
+
+    residency.acquire("game-win");
+    check(residency.getResidentBytes() == 2 * screenBytes, "a third screen evicts one");
+    check(residency.getEvictedBytes() == screenBytes, "the evicted screen is counted");
+} // testResidentAndEvictedBytes()
+
+void testLeastRecentlyUsedIsEvicted()
+{
+    assetResidency residency(2 * screenBytes);
+    residency.acquire("background");
+    residency.acquire("game-menu");
+
+    // The background becomes the most recently used
+    residency.acquire("background");
+    residency.acquire("game-win");
+    check(residency.isResident("background"), "a screen used again stays resident");
+    check(!residency.isResident("game-menu"), "the least recently used screen is evicted");
+    check(residency.isResident("game-win"), "the acquired screen is resident");
+
+    residency.acquire("game-over");
+    check(!residency.isResident("background"), "the eviction follows the order of use");
+    check(residency.isResident("game-win") && residency.isResident("game-over"), "the two last screens are resident");
+} // testLeastRecentlyUsedIsEvicted()
+
+void testAcquiredImageSurvivesEmptyBudget()
+{
+    assetResidency residency(2 * screenBytes);
+    std::shared_ptr<const nsGui::Sprite> background = residency.acquire("background");
+    residency.acquire("game-menu");
+
+    residency.setBudget(0);
+    check(residency.isResident("background"), "an image in use is not evicted");
+    check(!residency.isResident("game-menu"), "a released image is evicted when the budget is lowered");
+    check(residency.getResidentBytes() == screenBytes, "only the image in use is resident");
+    check(background->getPixelCount() != 0, "the image in use is intact");
+
+    std::shared_ptr<const nsGui::Sprite> win = residency.acquire("game-win");
+    check(residency.isResident("background") && residency.isResident("game-win"), "acquiring over budget keeps both");
+
+    background.reset();
+    residency.trim();
+    check(!residency.isResident("background"), "trim() evicts the released image");
+    check(residency.isResident("game-win"), "trim() keeps the image still in use");
+    check(residency.getResidentBytes() == screenBytes, "the resident bytes follow the evictions");
+    check(residency.getEvictedBytes() == 2 * screenBytes, "both released images are counted as evicted");
+
+    win.reset();
+    residency.trim();
+    check(residency.getResidentBytes() == 0, "nothing stays resident under an empty budget");
+} // testAcquiredImageSurvivesEmptyBudget()
+
+} // namespace
+
+int main()
+{
+    if (chdir(GAME_DIRECTORY) != 0)
+    {
+        std::cerr << "cannot enter " << GAME_DIRECTORY << std::endl;
+        return 1;
+    }
+
+    {
+        assetResidency residency(0);
+        residency.acquire("background");
+        screenBytes = residency.getResidentBytes();
+    }
+    check(screenBytes != 0, "the background is loaded");
+
+    testResidentAndEvictedBytes();
+    testLeastRecentlyUsedIsEvicted();
+    testAcquiredImageSurvivesEmptyBudget();
+
+    if (failures != 0)
+        return 1;
+
+    std::cout << "asset_residency: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,9 @@
+TEMPLATE = app
+CONFIG += console c++17 no_sfml
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../MinGL2/mingl.pri)
+
+SOURCES += \
+    tst_audio_frame_time.cpp
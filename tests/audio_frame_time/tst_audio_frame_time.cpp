@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mingl/audio/audioengine.h"
+#include "mingl/audio/offline_mixer.h"
+
+// Plays file-backed sounds during a simulated game, and measures how long each frame spends in AudioEngine calls.
+// The OfflineMixer stands in for the sound card, so the test needs no audio device: 600 frames of 735 samples
+// (60 frames per second at 44.1 kHz), a 1 s effect read from its file every 30 frames, and a switch to a 20 s
+// music at frame 300. The synchronous calls decode the files on the game thread; the asynchronous ones must not.
+
+namespace {
+
+const unsigned frameCount = 600;
+const size_t samplesPerFrame = 735;
+const unsigned effectPeriod = 30;
+const unsigned musicFrame = 300;
+// A 60 fps frame: the asynchronous calls must never take a whole frame
+const std::chrono::microseconds frameBudget(16667);
+
+// Writes a 16 bits stereo sine wave, so that the decoding cost is that of a real effect or music
+void writeWav(const std::string& fileName, const unsigned& sampleRate, const unsigned& seconds)
+{
+    const uint32_t frames = sampleRate * seconds;
+    const uint32_t dataSize = frames * 2 * sizeof(int16_t);
+    std::ofstream out(fileName, std::ios::binary);
+
+    auto write = [&out](const uint32_t& value, const int& size) { out.write(reinterpret_cast<const char*>(&value), size); };
+    out.write("RIFF", 4); write(36 + dataSize, 4); out.write("WAVE", 4);
+    out.write("fmt ", 4); write(16, 4); write(1, 2); write(2, 2); write(sampleRate, 4);
+    write(sampleRate * 4, 4); write(4, 2); write(16, 2);
+    out.write("data", 4); write(dataSize, 4);
+
+    std::vector<int16_t> samples(size_t(frames) * 2);
+    for (uint32_t i = 0; i < frames; ++i)
+        samples[2 * i] = samples[2 * i + 1] = int16_t(8000 * std::sin(i * 2 * M_PI * 440 / sampleRate));
+    out.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(int16_t));
+} // writeWav()
+
+struct result {
+    std::chrono::microseconds worstFrame;
+    std::chrono::microseconds totalTime;
+    unsigned long long loadErrors;
+};
+
+result playGame(const bool& async, const std::string& effect, const std::string& music)
+{
+    nsAudio::OfflineMixer *mixer = new nsAudio::OfflineMixer();
+    nsAudio::AudioEngine engine{std::unique_ptr<nsAudio::IAudioBackend>(mixer)};
+
+    result measured{std::chrono::microseconds::zero(), std::chrono::microseconds::zero(), 0};
+    for (unsigned frame = 0; frame < frameCount; ++frame)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        if (frame % effectPeriod == 0)
+        {
+            if (async)
+                engine.playSoundFromFileAsync(effect);
+            else
+                engine.playSoundFromFile(effect);
+        }
+        if (frame == musicFrame)
+        {
+            if (async)
+                engine.setMusicAsync(music);
+            else
+                engine.setMusic(music);
+        }
+        engine.update();
+
+        const std::chrono::microseconds elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        measured.worstFrame = std::max(measured.worstFrame, elapsed);
+        measured.totalTime += elapsed;
+
+        // The sound card's share of the frame, outside of the measured game thread work
+        mixer->render(samplesPerFrame);
+    }
+
+    measured.loadErrors = engine.getLoadErrorCount();
+    return measured;
+} // playGame()
+
+} // namespace
+
+int main()
+{
+    const std::string effect = "tst_audio_frame_time_effect.wav";
+    const std::string music = "tst_audio_frame_time_music.wav";
+    writeWav(effect, 48000, 1);
+    writeWav(music, 48000, 20);
+
+    const result sync = playGame(false, effect, music);
+    const result async = playGame(true, effect, music);
+
+    std::remove(effect.c_str());
+    std::remove(music.c_str());
+
+    std::cout << "audio_frame_time: worst frame " << sync.worstFrame.count() / 1000.0 << " ms synchronous, "
+              << async.worstFrame.count() / 1000.0 << " ms asynchronous (total "
+              << sync.totalTime.count() / 1000.0 << " ms, " << async.totalTime.count() / 1000.0 << " ms)" << std::endl;
+
+    int failures = 0;
+    if (async.loadErrors != 0)
+    {
+        std::cerr << "FAILED: the asynchronous loads reported " << async.loadErrors << " errors" << std::endl;
+        ++failures;
+    }
+    if (async.worstFrame >= frameBudget)
+    {
+        std::cerr << "FAILED: an asynchronous frame took longer than a 60 fps frame" << std::endl;
+        ++failures;
+    }
+
+    if (failures != 0)
+        return 1;
+
+    std::cout << "audio_frame_time: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,12 @@
+TEMPLATE = app
+CONFIG += console c++17 no_sfml
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../MinGL2/mingl.pri)
+
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    $$PWD/../../flashlayer.cpp \
+    tst_flash_layer.cpp
@@ -0,0 +1,75 @@
+#include <chrono>
+#include <iostream>
+#include "flashlayer.h"
+
+// Kills flashes and updates the engine with uneven frame times, as a real game loop does. The flashes used to be
+// removed as soon as their alpha was 0, which happens before the end of their fade: the engine then wrote to
+// destroyed rectangles on the next update. Build with -fsanitize=address to catch such accesses.
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char *what)
+{
+    if (condition)
+        return;
+
+    std::cerr << "FAILED: " << what << std::endl;
+    ++failures;
+}
+
+// Microseconds, including the 16000 / 6944 / 20000 sequence that used to touch a freed flash
+const long long frameTimes[] = {16000, 6944, 20000, 33333, 1000, 16667, 250, 49999, 8333, 16000};
+const size_t frameTimeCount = sizeof(frameTimes) / sizeof(frameTimes[0]);
+
+void testFlashesOutliveTheirFade()
+{
+    nsTransition::TransitionEngine transitions;
+    flashLayer flashes(transitions, std::chrono::milliseconds(250));
+
+    // One flash started every few frames, so that they end on every kind of frame time
+    for (size_t frame = 0; frame < 200; ++frame)
+    {
+        if (frame % 3 == 0 && frame < 120)
+            flashes.start(nsGraphics::Rect::fromPositionSize(nsGraphics::Vec2D(frame, 0), nsGraphics::Vec2D(32, 32)));
+
+        transitions.update(std::chrono::microseconds(frameTimes[frame % frameTimeCount]));
+        flashes.removeFinished();
+
+        // Each flash has exactly one fade, still in the engine until the update after it ends
+        check(flashes.getCount() <= transitions.getTransitionCount(), "a flash was removed before its fade");
+    }
+
+    transitions.update(std::chrono::microseconds(0));
+    check(flashes.getCount() == 0, "every flash is removed once faded");
+    check(transitions.getTransitionCount() == 0, "every fade is done");
+} // testFlashesOutliveTheirFade()
+
+void testLayerDestroyedMidFade()
+{
+    nsTransition::TransitionEngine transitions;
+    {
+        flashLayer flashes(transitions, std::chrono::milliseconds(250));
+        flashes.start(nsGraphics::Rect::fromPositionSize(nsGraphics::Vec2D(0, 0), nsGraphics::Vec2D(32, 32)));
+        transitions.update(std::chrono::microseconds(6944));
+    }
+
+    // The engine must not write to the destroyed flash
+    transitions.update(std::chrono::microseconds(16000));
+    check(transitions.getTransitionCount() == 0, "the fades of a destroyed layer are dropped");
+} // testLayerDestroyedMidFade()
+
+} // namespace
+
+int main()
+{
+    testFlashesOutliveTheirFade();
+    testLayerDestroyedMidFade();
+
+    if (failures != 0)
+        return 1;
+
+    std::cout << "flash_layer: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,9 @@
+# Headless tests: each one is a program returning 0 on success. Run them from the build directory:
+#   qmake tests/tests.pro && make && ./asset_residency/asset_residency && ./audio_frame_time/audio_frame_time \
+#   && ./flash_layer/flash_layer
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    asset_residency \
+    audio_frame_time \
+    flash_layer
@@ -0,0 +1,175 @@
+#include "uilayer.h"
+
+/**
+ * @brief Packs a grid cell coordinate into a single hash key.
+ */
+long long UiLayer::cellKey(int cellX, int cellY)
+{
+    return (static_cast<long long>(cellX) << 32) ^ static_cast<unsigned int>(cellY);
+} // cellKey(int cellX, int cellY)
+
+/**
+ * @brief Returns the grid cell containing a coordinate, rounding towards negative infinity.
+ */
+int UiLayer::cellOf(int coordinate)
+{
+    return (coordinate >= 0) ? coordinate / cellSize : (coordinate - cellSize + 1) / cellSize;
+} // cellOf(int coordinate)
+
+/**
+ * @brief Registers a button in every grid cell its cached bounds overlap.
+ *
+ * @param index The index of the button in the buttons vector.
+ */
+void UiLayer::indexButton(size_t index)
+{
+    const Button& btn = buttons[index];
+    for (int cx = cellOf(btn.getBoundsStart().getX()); cx <= cellOf(btn.getBoundsEnd().getX()); ++cx)
+        for (int cy = cellOf(btn.getBoundsStart().getY()); cy <= cellOf(btn.getBoundsEnd().getY()); ++cy)
+            cells[cellKey(cx, cy)].push_back(index);
+} // indexButton(size_t index)
+
+/**
+ * @brief Adds a button to the layer, laying it out and indexing it once.
+ *
+ * @return The index of the new button, usable with getButton().
+ */
+size_t UiLayer::addButton(const nsGraphics::Vec2D& pos, const nsGraphics::Vec2D& size,
+                          const std::string& label, const std::function<void()>& onClick,
+                          nsGui::GlutFont::GlutFonts font)
+{
+    buttons.emplace_back(pos, size, label, onClick, font);
+    indexButton(buttons.size() - 1);
+
+    // A new button may already sit under the cursor
+    hasMouse = false;
+    dirty = true;
+    return buttons.size() - 1;
+} // addButton(...)
+
+/**
+ * @brief Adds a static label, drawn after the buttons.
+ */
+void UiLayer::addLabel(const nsGui::Text& label)
+{
+    labels.push_back(label);
+    dirty = true;
+} // addLabel(const nsGui::Text& label)
+
+/**
+ * @brief Removes every widget from the layer.
+ */
+void UiLayer::clear()
+{
+    buttons.clear();
+    labels.clear();
+    cells.clear();
+    hasMouse = false;
+    hovered = -1;
+    dirty = true;
+} // clear()
+
+Button& UiLayer::getButton(size_t index)
+{
+    return buttons[index];
+} // getButton(size_t index)
+
+size_t UiLayer::getButtonCount() const
+{
+    return buttons.size();
+} // getButtonCount() const
+
+/**
+ * @brief Finds the button under the given position using the grid index.
+ *
+ * @return The index of the button, or -1 if there is none.
+ */
+int UiLayer::hitTest(const nsGraphics::Vec2D& mouse) const
+{
+    auto it = cells.find(cellKey(cellOf(mouse.getX()), cellOf(mouse.getY())));
+    if (it == cells.end())
+        return -1;
+
+    for (size_t index : it->second) {
+        if (buttons[index].isMouseOver(mouse))
+            return static_cast<int>(index);
+    }
+    return -1;
+} // hitTest(const nsGraphics::Vec2D& mouse) const
+
+/**
+ * @brief Updates the hover state from the mouse position.
+ *
+ * Nothing is tested when the mouse has not moved, and only the previously
+ * and newly hovered buttons are touched when it has.
+ *
+ * @return true if a hover state changed.
+ */
+bool UiLayer::updateHover(const nsGraphics::Vec2D& mouse)
+{
+    if (hasMouse && mouse == lastMouse)
+        return false;
+
+    lastMouse = mouse;
+    hasMouse = true;
+
+    int current = hitTest(mouse);
+    if (current == hovered)
+        return false;
+
+    if (hovered >= 0)
+        buttons[hovered].setHover(false);
+    if (current >= 0)
+        buttons[current].setHover(true);
+    hovered = current;
+    return true;
+} // updateHover(const nsGraphics::Vec2D& mouse)
+
+/**
+ * @brief Triggers the click handler of the button under the mouse, if any.
+ *
+ * The handler is copied before being called, so it may safely clear or
+ * rebuild this layer.
+ *
+ * @return true if a button was clicked.
+ */
+bool UiLayer::click(const nsGraphics::Vec2D& mouse)
+{
+    int index = hitTest(mouse);
+    if (index < 0)
+        return false;
+
+    std::function<void()> onClick = buttons[index].getOnClick();
+    if (onClick)
+        onClick();
+    return true;
+} // click(const nsGraphics::Vec2D& mouse)
+
+/**
+ * @brief Tells whether something changed since the last draw.
+ */
+bool UiLayer::isDirty() const
+{
+    if (dirty)
+        return true;
+
+    for (const auto& btn : buttons) {
+        if (btn.isDirty())
+            return true;
+    }
+    return false;
+} // isDirty() const
+
+/**
+ * @brief Draws the retained widgets and clears the dirty flags.
+ */
+void UiLayer::draw(MinGL& window)
+{
+    for (auto& btn : buttons) {
+        btn.draw(window);
+        btn.clearDirty();
+    }
+    for (const auto& label : labels)
+        window << label;
+    dirty = false;
+} // draw(MinGL& window)
@@ -0,0 +1,55 @@
+#ifndef UILAYER_H
+#define UILAYER_H
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "button.h"
+#include "mingl/mingl.h"
+#include "mingl/gui/text.h"
+
+/**
+ * @brief Retained-mode widget tree for the menu and end screens.
+ *
+ * The layer is the root of a flat tree of buttons and static labels. Widget
+ * geometry is computed once when a widget is added, hover and label changes
+ * set dirty flags, and hit-testing goes through a uniform grid so only the
+ * buttons overlapping the cursor's cell are tested.
+ */
+class UiLayer
+{
+private:
+    static const int cellSize = 64;
+
+    std::vector<Button> buttons;
+    std::vector<nsGui::Text> labels;
+    std::unordered_map<long long, std::vector<size_t>> cells;
+    nsGraphics::Vec2D lastMouse;
+    bool hasMouse = false;
+    int hovered = -1;
+    bool dirty = true;
+
+    static long long cellKey(int cellX, int cellY);
+    static int cellOf(int coordinate);
+    void indexButton(size_t index);
+
+public:
+    size_t addButton(const nsGraphics::Vec2D& pos, const nsGraphics::Vec2D& size,
+                     const std::string& label, const std::function<void()>& onClick,
+                     nsGui::GlutFont::GlutFonts font);
+    void addLabel(const nsGui::Text& label);
+    void clear();
+
+    Button& getButton(size_t index);
+    size_t getButtonCount() const;
+
+    int hitTest(const nsGraphics::Vec2D& mouse) const;
+    bool updateHover(const nsGraphics::Vec2D& mouse);
+    bool click(const nsGraphics::Vec2D& mouse);
+
+    bool isDirty() const;
+    void draw(MinGL& window);
+};
+
+#endif // UILAYER_H